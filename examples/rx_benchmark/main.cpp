@@ -0,0 +1,145 @@
+// Measure time it takes to receive edges
+//
+// The state machine of rx::Base gets selected by MDU_RX_SWITCH_STATE_MACHINE.
+// Build this benchmark twice (e.g. -DMDU_RX_SWITCH_STATE_MACHINE=ON/OFF and
+// CMAKE_BUILD_TYPE=Release) and compare the output. Every build measures both,
+// a ZPP decoder with virtual callbacks (rx::ZppBase) and one bound at compile
+// time (rx::StaticBase). The ZPP mixin makes sure that ZPP update packets
+// actually get buffered and executed.
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <cstdio>
+#include <mdu/mdu.hpp>
+#include <numeric>
+#include <vector>
+
+#define SN 0x12345678u
+#define ID 0x87654321u
+#define ITERATIONS 1000uz
+#define RUNS 10uz
+
+class Decoder : public mdu::rx::ZppBase {
+public:
+  Decoder() : mdu::rx::ZppBase{{.serial_number = SN, .decoder_id = ID}} {}
+
+  mutable size_t ackbits{};
+
+private:
+  // Generate current pulse of length "us" in µs
+  void ackbit(uint32_t) const final { ++ackbits; }
+
+  // Read CV bit
+  bool readCv(uint32_t, uint32_t) const final { return {}; }
+
+  // Write CV
+  bool writeCv(uint32_t, uint8_t) final { return {}; }
+
+  // Check if ZPP is valid
+  bool zppValid(std::string_view, size_t) const final { return true; }
+
+  // Check if load code is valid
+  bool loadCodeValid(std::span<uint8_t const, 4uz>) const final {
+    return true;
+  }
+
+  // Erase ZPP in the closed-interval [begin_addr, end_addr[
+  bool eraseZpp(uint32_t, uint32_t) final { return true; }
+
+  // Write ZPP
+  bool writeZpp(uint32_t, std::span<uint8_t const>) final { return true; }
+
+  // Update done
+  bool endZpp() final { return true; }
+
+  // Exit ZPP
+  [[noreturn]] void exitZpp(bool) final { std::abort(); }
+};
+
+class StaticDecoder
+  : public mdu::rx::StaticBase<StaticDecoder, mdu::rx::mixin::Zpp> {
+  friend mdu::rx::StaticBase<StaticDecoder, mdu::rx::mixin::Zpp>;
+  friend mdu::rx::mixin::Zpp<StaticDecoder>;
+
+public:
+  StaticDecoder()
+    : mdu::rx::StaticBase<StaticDecoder, mdu::rx::mixin::Zpp>{
+        {.serial_number = SN, .decoder_id = ID}} {}
+
+  mutable size_t ackbits{};
+
+private:
+  // Generate current pulse of length "us" in µs
+  void ackbit(uint32_t) const { ++ackbits; }
+
+  // Read CV bit
+  bool readCv(uint32_t, uint32_t) const { return {}; }
+
+  // Write CV
+  bool writeCv(uint32_t, uint8_t) { return {}; }
+
+  // Check if ZPP is valid
+  bool zppValid(std::string_view, size_t) const { return true; }
+
+  // Check if load code is valid
+  bool loadCodeValid(std::span<uint8_t const, 4uz>) const { return true; }
+
+  // Erase ZPP in the closed-interval [begin_addr, end_addr[
+  bool eraseZpp(uint32_t, uint32_t) { return true; }
+
+  // Write ZPP
+  bool writeZpp(uint32_t, std::span<uint8_t const>) { return true; }
+
+  // Update done
+  bool endZpp() { return true; }
+
+  // Exit ZPP
+  [[noreturn]] void exitZpp(bool) { std::abort(); }
+};
+
+// Edges of a ping, a CV read, a ZPP valid query and a ZPP update packet
+std::vector<uint32_t> make_edges() {
+  std::array<uint8_t, 256uz> zpp_data;
+  std::iota(begin(zpp_data), end(zpp_data), 0u);
+  std::vector<uint32_t> edges;
+  for (auto const& packet : {mdu::make_ping_packet(SN, ID),
+                             mdu::make_cv_read_packet(8u, 0u),
+                             mdu::make_zpp_valid_query_packet("SP", 0u),
+                             mdu::make_zpp_update_packet(0u, zpp_data)}) {
+    auto const timings{mdu::tx::packet2timings(packet)};
+    edges.insert(cend(edges), cbegin(timings), cend(timings));
+  }
+  return edges;
+}
+
+// Take best of several runs to reduce noise
+template<typename T>
+void run(char const* name, std::vector<uint32_t> const& edges) {
+  T decoder;
+  auto best{std::chrono::duration<double, std::nano>::max()};
+  for (auto run{0uz}; run < RUNS; ++run) {
+    auto const start{std::chrono::steady_clock::now()};
+    for (auto i{0uz}; i < ITERATIONS; ++i)
+      for (auto const edge : edges) {
+        decoder.receive(edge);
+        decoder.execute();
+      }
+    auto const stop{std::chrono::steady_clock::now()};
+    best = std::min<decltype(best)>(best, stop - start);
+  }
+
+  std::printf("%s, %s: %.2fns per edge (%zu ackbits)\n",
+              MDU_RX_SWITCH_STATE_MACHINE ? "switch"
+                                          : "member function pointer",
+              name,
+              best.count() / static_cast<double>(ITERATIONS * size(edges)),
+              decoder.ackbits);
+}
+
+int main() {
+  auto const edges{make_edges()};
+  run<Decoder>("virtual", edges);
+  run<StaticDecoder>("static", edges);
+}
@@ -10,13 +10,18 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
 #include "timing.hpp"
 
 namespace mdu {
 
 enum Bit : uint8_t { _0, _1, Ackreq, Invalid };
 
-/// Convert time to bit
+namespace detail {
+
+/// Convert time to bit by testing all windows
 ///
 /// \param  time                Time is µs
 /// \param  transfer_rate_index Current index of transfer rate
@@ -24,11 +29,87 @@ enum Bit : uint8_t { _0, _1, Ackreq, Invalid };
 /// \retval _1                  Time is a one bit
 /// \retval Ackreq              Time is a ackreq bit
 /// \retval Invalid             Time isn't valid
-constexpr Bit time2bit(uint32_t time, size_t transfer_rate_index) {
+constexpr Bit time2bit_windows(uint32_t time, size_t transfer_rate_index) {
   if (is_zero(time, transfer_rate_index)) return _0;
   else if (is_one(time, transfer_rate_index)) return _1;
   else if (is_ackreq(time, transfer_rate_index)) return Ackreq;
   else return Invalid;
 }
 
+/// Bit lookup table of a single transfer rate
+///
+/// Times within [bounds[i - 1], bounds[i][ convert to bits[i]. Unused bounds
+/// are set to UINT16_MAX.
+struct BitLut {
+  std::array<uint16_t, 12uz> bounds{};
+  std::array<Bit, 13uz> bits{};
+};
+
+/// Make bit lookup table
+///
+/// Each of the 6 windows (zero, one and ackreq of the transfer rate and the
+/// fallback) contributes two bounds. Bounds which don't change the bit get
+/// merged.
+///
+/// \param  transfer_rate_index Index of transfer rate
+/// \return Bit lookup table
+constexpr BitLut make_bit_lut(size_t transfer_rate_index) {
+  auto const& t{timings[transfer_rate_index]};
+  auto const& f{fallback_timing};
+  std::array<uint32_t, 12uz> points{t.zero_min,
+                                    t.zero_max + 1u,
+                                    t.one_min,
+                                    t.one_max + 1u,
+                                    t.ackreq_min,
+                                    t.ackreq_max + 1u,
+                                    f.zero_min,
+                                    f.zero_max + 1u,
+                                    f.one_min,
+                                    f.one_max + 1u,
+                                    f.ackreq_min,
+                                    f.ackreq_max + 1u};
+  std::ranges::sort(points);
+  BitLut lut{};
+  lut.bounds.fill(UINT16_MAX);
+  lut.bits.fill(Invalid);
+  auto n{0uz};
+  lut.bits[n] = time2bit_windows(0u, transfer_rate_index);
+  for (auto const p : points) {
+    auto const bit{time2bit_windows(p, transfer_rate_index)};
+    if (bit == lut.bits[n]) continue;
+    lut.bounds[n] = static_cast<uint16_t>(p);
+    lut.bits[++n] = bit;
+  }
+  return lut;
+}
+
+/// Bit lookup tables (index equals set transfer rate)
+inline constexpr auto bit_luts{[] {
+  std::array<BitLut, size(timings)> luts{};
+  for (auto i{0uz}; i < size(luts); ++i) luts[i] = make_bit_lut(i);
+  return luts;
+}()};
+
+} // namespace detail
+
+/// Convert time to bit
+///
+/// Instead of testing up to 12 bounds one after another, the number of bounds
+/// smaller or equal than time is counted and used as index into the bit lookup
+/// table of the current transfer rate. This takes constant time and no
+/// branches.
+///
+/// \param  time                Time is µs
+/// \param  transfer_rate_index Current index of transfer rate
+/// \retval _0                  Time is a zero bit
+/// \retval _1                  Time is a one bit
+/// \retval Ackreq              Time is a ackreq bit
+/// \retval Invalid             Time isn't valid
+constexpr Bit time2bit(uint32_t time, size_t transfer_rate_index) {
+  auto const& lut{detail::bit_luts[transfer_rate_index]};
+  auto i{0uz};
+  for (auto const bound : lut.bounds) i += time >= bound;
+  return lut.bits[i];
+}
+
 } // namespace mdu
@@ -16,32 +16,179 @@
 
 namespace mdu {
 
+namespace detail {
+
+/// "CRC32" of a single byte calculated bit by bit
+///
+/// \param  crc   Current CRC32
+/// \param  byte  Next byte
+/// \return Next CRC32
+constexpr uint32_t crc32_bitwise(uint32_t crc, uint8_t byte) {
+  for (auto i{0}; i < CHAR_BIT; ++i) {
+    uint32_t const tmp{crc};
+    crc <<= 1u;
+    if (byte & 0x80u) crc |= 1u;
+    if (tmp & 0x8000'0000u) crc ^= 0x4C11DB7u;
+    byte = static_cast<uint8_t>(byte << 1u);
+  }
+  return crc;
+}
+
+#if MDU_CRC32_LOOKUP_TABLE
+/// "CRC32" slicing-by-8 lookup tables
+///
+/// Entry i of table n contains the effect i has on the CRC after being shifted
+/// out by another n zero bytes. Table 0 alone is enough to process a single
+/// byte, all 8 tables together process 8 bytes at once.
+inline constexpr auto crc32_tables{[] {
+  std::array<std::array<uint32_t, 256uz>, 8uz> tables{};
+  for (auto i{0uz}; i < size(tables[0uz]); ++i)
+    tables[0uz][i] = crc32_bitwise(static_cast<uint32_t>(i << 24u), 0u);
+  for (auto n{1uz}; n < size(tables); ++n)
+    for (auto i{0uz}; i < size(tables[n]); ++i)
+      tables[n][i] = crc32_bitwise(tables[n - 1uz][i], 0u);
+  return tables;
+}()};
+#else
+/// "CRC32" nibble lookup table for finalization
+inline constexpr auto crc32_nibble_table{[] {
+  std::array<uint32_t, 16uz> table{};
+  for (auto i{0uz}; i < size(table); ++i)
+    table[i] = crc32_bitwise(static_cast<uint32_t>(i << 24u), 0u);
+  return table;
+}()};
+#endif
+
+/// Finalize "CRC32"
+///
+/// Finalization equals shifting 4 zero bytes through the CRC, which is the same
+/// as a multiplication by x^32 modulo the polynomial. Instead of 32 iterations
+/// this is done by either 4 lookups in the slicing-by-8 tables or 8 lookups in
+/// a 64 byte nibble table.
+///
+/// \param  crc Current CRC32
+/// \return Finalized CRC32
+constexpr uint32_t crc32_finalize(uint32_t crc) {
+#if MDU_CRC32_LOOKUP_TABLE
+  auto const& t{crc32_tables};
+  return t[3uz][crc >> 24u] ^ t[2uz][crc >> 16u & 0xFFu] ^
+         t[1uz][crc >> 8u & 0xFFu] ^ t[0uz][crc & 0xFFu];
+#else
+  for (auto i{0}; i < 8; ++i)
+    crc = crc << 4u ^ crc32_nibble_table[crc >> 28u];
+  return crc;
+#endif
+}
+
+/// Multiply two polynomials modulo the "CRC32" polynomial
+///
+/// \param  a First polynomial
+/// \param  b Second polynomial
+/// \return a * b mod P
+constexpr uint32_t crc32_multiply(uint32_t a, uint32_t b) {
+  uint32_t retval{};
+  for (auto i{32u}; i-- > 0u;) {
+    retval = retval << 1u ^ (retval & 0x8000'0000u ? 0x4C11DB7u : 0u);
+    if (b >> i & 1u) retval ^= a;
+  }
+  return retval;
+}
+
+/// Calculate x^(8n) modulo the "CRC32" polynomial
+///
+/// \param  n Number of bytes
+/// \return x^(8n) mod P
+constexpr uint32_t crc32_xpow8n(size_t n) {
+  uint32_t retval{1u};
+  for (uint32_t sq{1u << 8u}; n; n >>= 1u, sq = crc32_multiply(sq, sq))
+    if (n & 1u) retval = crc32_multiply(retval, sq);
+  return retval;
+}
+
+/// "CRC32" of a single byte
+///
+/// \param  crc   Current CRC32
+/// \param  byte  Next byte
+/// \return Next CRC32
+constexpr uint32_t crc32_next(uint32_t crc, uint8_t byte) {
+#if MDU_CRC32_LOOKUP_TABLE
+  return (crc << 8u | byte) ^ crc32_tables[0uz][crc >> 24u];
+#else
+  return crc32_bitwise(crc, byte);
+#endif
+}
+
+/// "CRC32" of bytes
+///
+/// \param  crc   Current CRC32
+/// \param  bytes Next bytes
+/// \return Next CRC32
+constexpr uint32_t crc32_next(uint32_t crc, std::span<uint8_t const> bytes) {
+  auto first{begin(bytes)};
+#if MDU_CRC32_LOOKUP_TABLE
+  auto const& t{crc32_tables};
+  for (; cend(bytes) - first >= 8; first += 8) {
+    crc = t[7uz][crc >> 24u] ^ t[6uz][crc >> 16u & 0xFFu] ^
+          t[5uz][crc >> 8u & 0xFFu] ^ t[4uz][crc & 0xFFu] ^ t[3uz][first[0]] ^
+          t[2uz][first[1]] ^ t[1uz][first[2]] ^ t[0uz][first[3]] ^
+          static_cast<uint32_t>(first[4] << 24u | first[5] << 16u |
+                                first[6] << 8u | first[7] << 0u);
+  }
+#endif
+  std::for_each(
+    first, cend(bytes), [&crc](uint8_t byte) { crc = crc32_next(crc, byte); });
+  return crc;
+}
+
+#if MDU_CRC32_CLMUL
+/// "CRC32" of bytes calculated by folding with carry-less multiplication
+///
+/// Dispatches at runtime to a PCLMULQDQ kernel if the CPU supports it and
+/// falls back to crc32_next otherwise.
+///
+/// \param  crc   Current CRC32
+/// \param  bytes Next bytes
+/// \return Next CRC32
+uint32_t crc32_clmul(uint32_t crc, std::span<uint8_t const> bytes);
+#endif
+
+} // namespace detail
+
 /// "CRC32" with no polynomial representation whatsoever...
+///
+/// Depending on MDU_CRC32_LOOKUP_TABLE the CRC is either calculated using 8KiB
+/// of slicing-by-8 lookup tables or bit by bit. Hosts additionally offload
+/// larger spans to a carry-less multiplication kernel if MDU_CRC32_CLMUL is
+/// set.
 struct Crc32 : detail::CrcBase<uint32_t, static_cast<uint32_t>(-1)> {
-  constexpr void next(uint8_t byte) {
-    for (auto i{0}; i < CHAR_BIT; ++i) {
-      uint32_t const tmp{_crc};
-      _crc <<= 1u;
-      if (byte & 0x80u) _crc |= 1u;
-      if (tmp & 0x8000'0000u) _crc ^= 0x4C11DB7u;
-      byte = static_cast<uint8_t>(byte << 1u);
-    }
-  }
+  constexpr void next(uint8_t byte) { _crc = detail::crc32_next(_crc, byte); }
 
   constexpr void next(std::span<uint8_t const> bytes) {
-    std::ranges::for_each(bytes, [this](uint8_t byte) { next(byte); });
+#if MDU_CRC32_CLMUL
+    if !consteval {
+      if (size(bytes) >= 64uz) {
+        _crc = detail::crc32_clmul(_crc, bytes);
+        return;
+      }
+    }
+#endif
+    _crc = detail::crc32_next(_crc, bytes);
   }
 
-  constexpr uint32_t value() {
-    auto const cpy{_crc};
-    constexpr std::array<uint8_t, 4uz> zeros{};
-    next(zeros);
-    auto const retval{_crc};
-    _crc = cpy;
-    return retval;
-  }
+  /// Get finalized CRC
+  ///
+  /// \return CRC32
+  constexpr uint32_t value() const { return detail::crc32_finalize(_crc); }
 
-  constexpr operator uint32_t() { return value(); }
+  /// Get CRC without finalization
+  ///
+  /// Since finalization is invertible the state is zero if and only if the
+  /// finalized CRC is. Checking a received CRC can therefore skip finalization.
+  ///
+  /// \return Current state
+  constexpr uint32_t state() const { return _crc; }
+
+  constexpr operator uint32_t() const { return value(); }
 };
 
 static_assert(sizeof(Crc32) == sizeof(uint32_t));
@@ -56,4 +203,19 @@ constexpr uint32_t crc32(std::span<uint8_t const> bytes) {
   return crc;
 }
 
+/// Combine two "CRC32"
+///
+/// Calculates the "CRC32" of the concatenation of two byte sequences A and B
+/// from their individual CRCs and the length of B in O(log(len_b)).
+///
+/// \param  crc_a "CRC32" of A
+/// \param  crc_b "CRC32" of B
+/// \param  len_b Length of B in bytes
+/// \return "CRC32" of A followed by B
+constexpr uint32_t
+crc32_combine(uint32_t crc_a, uint32_t crc_b, size_t len_b) {
+  auto const xpow8n{detail::crc32_xpow8n(len_b)};
+  return detail::crc32_multiply(crc_a ^ crc32({}), xpow8n) ^ crc_b;
+}
+
 } // namespace mdu
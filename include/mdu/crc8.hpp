@@ -11,6 +11,7 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <cstdint>
 #include <span>
 
@@ -32,22 +33,46 @@ protected:
   T _crc{Init};
 };
 
+/// Dallas/Maxim CRC8 of a single byte calculated bit by bit
+///
+/// \param  crc Current CRC8 XORed with next byte
+/// \return Next CRC8
+constexpr uint8_t crc8_bitwise(uint8_t crc) {
+  uint8_t tmp{};
+  if (crc & 0x01u) tmp ^= 0x5Eu;
+  if (crc & 0x02u) tmp ^= 0xBCu;
+  if (crc & 0x04u) tmp ^= 0x61u;
+  if (crc & 0x08u) tmp ^= 0xC2u;
+  if (crc & 0x10u) tmp ^= 0x9Du;
+  if (crc & 0x20u) tmp ^= 0x23u;
+  if (crc & 0x40u) tmp ^= 0x46u;
+  if (crc & 0x80u) tmp ^= 0x8Cu;
+  return tmp;
+}
+
+#if MDU_CRC8_LOOKUP_TABLE
+/// Dallas/Maxim CRC8 lookup table
+inline constexpr auto crc8_table{[] {
+  std::array<uint8_t, 256uz> table{};
+  for (auto i{0uz}; i < size(table); ++i)
+    table[i] = crc8_bitwise(static_cast<uint8_t>(i));
+  return table;
+}()};
+#endif
+
 } // namespace detail
 
 /// Dallas/Maxim CRC8 with polynomial representation 0x31u
+///
+/// Depending on MDU_CRC8_LOOKUP_TABLE the CRC is either calculated using a 256
+/// byte lookup table or bit by bit.
 struct Crc8 : detail::CrcBase<uint8_t, 0u> {
   constexpr void next(uint8_t byte) {
-    _crc ^= byte;
-    uint8_t tmp{};
-    if (_crc & 0x01u) tmp ^= 0x5Eu;
-    if (_crc & 0x02u) tmp ^= 0xBCu;
-    if (_crc & 0x04u) tmp ^= 0x61u;
-    if (_crc & 0x08u) tmp ^= 0xC2u;
-    if (_crc & 0x10u) tmp ^= 0x9Du;
-    if (_crc & 0x20u) tmp ^= 0x23u;
-    if (_crc & 0x40u) tmp ^= 0x46u;
-    if (_crc & 0x80u) tmp ^= 0x8Cu;
-    _crc = tmp;
+#if MDU_CRC8_LOOKUP_TABLE
+    _crc = detail::crc8_table[_crc ^ byte];
+#else
+    _crc = detail::crc8_bitwise(_crc ^ byte);
+#endif
   }
 
   constexpr void next(std::span<uint8_t const> bytes) {
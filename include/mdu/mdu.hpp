@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include "rx/capture_adapter.hpp"
 #include "rx/entry/point.hpp"
 #include "rx/zpp_base.hpp"
 #include "rx/zsu_base.hpp"
@@ -13,6 +13,7 @@
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <span>
 #include <string_view>
 #include <ztl/inplace_vector.hpp>
 #include "command.hpp"
@@ -28,7 +29,7 @@ using Packet = ztl::inplace_vector<uint8_t, MDU_MAX_PACKET_SIZE>;
 ///
 /// \param  packet  Packet
 /// \return Command
-constexpr Command packet2command(Packet const& packet) {
+constexpr Command packet2command(std::span<uint8_t const> packet) {
   return static_cast<Command>(data2uint32(data(packet)));
 }
 
@@ -0,0 +1,30 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// Ack pulse
+///
+/// \file   mdu/rx/ack_pulse.hpp
+/// \author Vincent Hamp
+/// \date   18/10/2026
+
+#pragma once
+
+#include <cstdint>
+
+namespace mdu::rx {
+
+/// Request to generate a current pulse
+///
+/// Decoders without ackbit callback get these queued by receive instead. time
+/// is the sum of all times received so far (wrapping at 32 bit). It's neither
+/// a timer capture nor scaled in any way, so relating it to a timer is up to
+/// the decoder (e.g. by noting time and capture of the first edge).
+struct AckPulse {
+  uint32_t time{};  ///< Time of edge the pulse starts at in µs
+  uint16_t us{};    ///< Length of pulse in µs
+  uint8_t period{}; ///< PWM period in µs (0 for continuous current)
+  uint8_t duty{};   ///< PWM duty cycle in %
+};
+
+} // namespace mdu::rx
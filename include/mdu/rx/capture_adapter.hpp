@@ -0,0 +1,95 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// Capture adapter which feeds timer captures into a decoder
+///
+/// \file   mdu/rx/capture_adapter.hpp
+/// \author Vincent Hamp
+/// \date   18/10/2026
+
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+
+namespace mdu::rx {
+
+/// Capture adapter
+///
+/// Takes raw captures of a free running timer, calculates the ticks since the
+/// last capture modulo the timer width and converts them to µs. The conversion
+/// is split into an integer and a 0.32 fixed-point fractional factor, which
+/// takes two multiplications (one of them 32x32=64 bit) and no division. Timers
+/// running at 1MHz pass timestamps in µs, the conversion then folds away.
+///
+/// The very first capture only serves as reference and isn't turned into a
+/// time.
+///
+/// \tparam D         Type of decoder (e.g. rx::ZppBase)
+/// \tparam Bits      Width of timer in bits
+/// \tparam Frequency Frequency of timer in Hz
+template<typename D, size_t Bits, uint32_t Frequency>
+requires(Bits > 0uz && Bits <= 32uz && Frequency > 0u &&
+         requires(D& d, uint32_t time) { d.receive(time); })
+class CaptureAdapter {
+  /// Mask of timer width
+  static constexpr uint32_t mask{Bits < 32uz ? (1u << Bits) - 1u
+                                             : UINT32_MAX};
+
+  /// Integer part of µs per tick
+  static constexpr uint32_t int_factor{1'000'000u / Frequency};
+
+  /// Fractional part of µs per tick (0.32 fixed-point, rounded up so that
+  /// whole µs don't get truncated)
+  static constexpr uint32_t frac_factor{static_cast<uint32_t>(
+    ((static_cast<uint64_t>(1'000'000u % Frequency) << 32u) + Frequency - 1u) /
+    Frequency)};
+
+public:
+  /// Ctor
+  ///
+  /// \param  decoder Decoder to feed
+  explicit constexpr CaptureAdapter(D& decoder) : _decoder{decoder} {}
+
+  /// Convert ticks to µs
+  ///
+  /// \param  ticks Ticks
+  /// \return Time in µs (rounded down)
+  static constexpr uint32_t ticks2us(uint32_t ticks) {
+    return ticks * int_factor +
+           static_cast<uint32_t>(static_cast<uint64_t>(ticks) * frac_factor >>
+                                 32u);
+  }
+
+  /// Receive capture
+  ///
+  /// \param  capture Capture
+  void receive(uint32_t capture) {
+    auto const ticks{(capture - _last_capture) & mask};
+    _last_capture = capture;
+    if (std::exchange(_valid, true)) _decoder.receive(ticks2us(ticks));
+  }
+
+  /// Receive buffer of captures
+  ///
+  /// Convenience wrapper which calls receive for every capture.
+  ///
+  /// \tparam T         Type of captures
+  /// \param  captures  Captures
+  template<std::unsigned_integral T>
+  requires(sizeof(T) <= sizeof(uint32_t))
+  void receive(std::span<T const> captures) {
+    for (auto const capture : captures) receive(capture);
+  }
+
+private:
+  D& _decoder;
+  uint32_t _last_capture{};
+  bool _valid{};
+};
+
+} // namespace mdu::rx
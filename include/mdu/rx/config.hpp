@@ -19,6 +19,8 @@ struct Config {
   uint32_t serial_number{};
   uint32_t decoder_id{};
   TransferRate transfer_rate{TransferRate::Default};
+  uint8_t ack_pwm_period{};   ///< PWM period of queued ack pulses in µs
+  uint8_t ack_pwm_duty{100u}; ///< PWM duty cycle of queued ack pulses in %
 };
 
 } // namespace mdu::rx
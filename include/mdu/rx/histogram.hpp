@@ -0,0 +1,67 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// Receive histogram
+///
+/// \file   mdu/rx/histogram.hpp
+/// \author Vincent Hamp
+/// \date   18/10/2026
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include "../bit.hpp"
+
+namespace mdu::rx {
+
+/// Histogram of received times split by the bit they were classified as
+///
+/// Bin i counts times within [i * BinWidth, (i + 1) * BinWidth[, the last bin
+/// also counts all times beyond. Only receive writes the bins, the application
+/// can read them at any time.
+///
+/// \tparam Bins      Number of bins
+/// \tparam BinWidth  Width of a single bin in µs
+template<size_t Bins, uint32_t BinWidth>
+requires(Bins > 0uz && BinWidth > 0u)
+struct Histogram {
+  static constexpr auto bins{Bins};
+  static constexpr auto bin_width{BinWidth};
+
+  /// Add time
+  ///
+  /// \param  time  Time in µs
+  /// \param  bit   Bit time was classified as
+  void add(uint32_t time, Bit bit) {
+    auto& counter{_counts[bit][bin(time)]};
+    counter.store(counter.load(std::memory_order_relaxed) + 1u,
+                  std::memory_order_relaxed);
+  }
+
+  /// Get count of bin
+  ///
+  /// \param  bit Bit
+  /// \param  i   Index of bin
+  /// \return Number of times classified as bit which fell into bin i
+  uint32_t count(Bit bit, size_t i) const {
+    return _counts[bit][i].load(std::memory_order_relaxed);
+  }
+
+  /// Get index of bin
+  ///
+  /// \param  time  Time in µs
+  /// \return Index of bin
+  static constexpr size_t bin(uint32_t time) {
+    return std::min<size_t>(time / BinWidth, Bins - 1uz);
+  }
+
+private:
+  std::array<std::array<std::atomic<uint32_t>, Bins>, Invalid + 1uz> _counts{};
+};
+
+} // namespace mdu::rx
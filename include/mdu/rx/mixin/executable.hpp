@@ -10,19 +10,25 @@
 
 #pragma once
 
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
 #include <type_traits>
 #include "../../command.hpp"
-#include "../../packet.hpp"
 
 namespace mdu::rx::mixin {
 
-/// Mixins must be executable
+/// Mixins must be executable and state the largest packet they execute
 template<typename T>
 concept Executable = std::is_invocable_r_v<bool,
                                            decltype(&T::execute),
                                            T*,
                                            Command,
-                                           Packet const&,
-                                           uint32_t>;
+                                           std::span<uint8_t const>,
+                                           uint32_t> &&
+                     requires {
+                       { T::max_packet_size } -> std::convertible_to<size_t>;
+                     };
 
 } // namespace mdu::rx::mixin
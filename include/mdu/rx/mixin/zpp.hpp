@@ -10,23 +10,298 @@
 
 #pragma once
 
+#include <bit>
+#include <concepts>
+#include <cstddef>
 #include <cstdint>
 #include <optional>
 #include <span>
 #include <string_view>
+#include <utility>
 #include "../../command.hpp"
+#include "../../crc32.hpp"
 #include "../../packet.hpp"
+#include "../../utility.hpp"
 
 namespace mdu::rx::mixin {
 
+struct ZppCallbacks;
+
 /// Provides ZPP update logic
+///
+/// Calls the ZPP callbacks of the type to downcast to directly. Base binds them
+/// to the virtual functions of ZppCallbacks.
+///
+/// \tparam T Type to downcast to
+template<typename T>
 struct Zpp {
-  /// Dtor
-  virtual constexpr ~Zpp() = default;
+  /// Virtual callbacks used by Base
+  using Callbacks = ZppCallbacks;
+
+  /// Largest packet (ZppUpdate)
+  static constexpr size_t max_packet_size{sizeof(Command) + sizeof(uint32_t) +
+                                          256uz + sizeof(Crc32)};
+
+  /// Size of chunks of ZppUpdate payload handed to streamZpp
+  static constexpr size_t stream_chunk_size{64uz};
+
+  /// Execute ZPP commands
+  ///
+  /// \param  cmd     Command
+  /// \param  packet  Packet
+  /// \retval true    Transmit ackbit in channel2
+  /// \retval false   Do not transmit ackbit in channel2
+  bool execute(Command cmd, std::span<uint8_t const> packet, uint32_t) {
+    // The following commands may run without ZPP validation
+    switch (cmd) {
+      case Command::ZppValidQuery: {
+        std::string_view zpp_id{std::bit_cast<char*>(&packet[4uz]), 2uz};
+        auto const zpp_flash_size{data2uint32(&packet[6uz])};
+        return executeValidQuery(zpp_id, zpp_flash_size);
+      }
+      case Command::ZppExit: return executeExit(false);
+      case Command::ZppExitReset: return executeExit(true);
+      default: break;
+    }
+
+    // All others may not
+    if (!_zpp_valid) {
+      if (cmd == Command::ZppUpdate) abortPayload(data2uint32(&packet[4uz]));
+      return true;
+    }
+    switch (cmd) {
+      case Command::ZppLcDcQuery: {
+        std::span<uint8_t const, 4uz> developer_code{&packet[4uz], 4uz};
+        return executeLcDcQuery(developer_code);
+      }
+      case Command::ZppErase: {
+        auto const begin_addr{data2uint32(&packet[4uz])};
+        auto const end_addr{data2uint32(&packet[8uz])};
+        return executeErase(begin_addr, end_addr);
+      }
+      case Command::ZppUpdate: {
+        auto const address{data2uint32(&packet[4uz])};
+        auto const bytes_size{size(packet) - sizeof(Command) -
+                              sizeof(address) - sizeof(Crc32)};
+        return executeUpdate(address, {&packet[8uz], bytes_size});
+      }
+      case Command::ZppUpdateEnd: {
+        auto const begin_addr{data2uint32(&packet[4uz])};
+        auto const end_addr{data2uint32(&packet[8uz])};
+        return executeEnd(begin_addr, end_addr);
+      }
+      default: return false;
+    }
+  }
+
+  /// Stream ZppUpdate payload while the packet is still being received
+  ///
+  /// Called after every byte. A chunk gets handed to streamZpp once the 4 bytes
+  /// following it are in too, so the trailing CRC32 never ends up in a chunk.
+  ///
+  /// \param  packet  Packet received so far
+  void stream(std::span<uint8_t const> packet) {
+    constexpr auto header_size{sizeof(Command) + sizeof(uint32_t)};
+    if (size(packet) < header_size + stream_chunk_size + sizeof(Crc32)) return;
+    auto const n{size(packet) - header_size - sizeof(Crc32)};
+    if (n % stream_chunk_size) return;
+    else if (n == stream_chunk_size) {
+      if (packet2command(packet) != Command::ZppUpdate) return;
+      _stream_addr = data2uint32(&packet[sizeof(Command)]);
+      _streaming = true;
+    } else if (!_streaming) return;
+    streamPayload(
+      static_cast<uint32_t>(_stream_addr + n - stream_chunk_size),
+      packet.subspan(header_size + n - stream_chunk_size, stream_chunk_size));
+  }
+
+  /// End streaming of ZppUpdate payload once the packet is complete or reset
+  ///
+  /// \param  valid Packet was received correctly
+  void endStream(bool valid) {
+    if (std::exchange(_streaming, false) && !valid) abortPayload(_stream_addr);
+  }
+
+  /// Abort streamed ZppUpdate payload of packet which doesn't get executed
+  ///
+  /// \param  packet  ZppUpdate packet
+  void abortStream(std::span<uint8_t const> packet) {
+    abortPayload(data2uint32(&packet[sizeof(Command)]));
+  }
+
+protected:
+  /// Check if type to downcast to implements the ZPP callbacks
+  ///
+  /// streamZpp, commitZpp and abortZpp are optional.
+  ///
+  /// \retval true  T implements the callbacks
+  /// \retval false T doesn't implement the callbacks
+  static consteval bool callbacks() {
+    return requires(T& t,
+                    T const& ct,
+                    std::string_view zpp_id,
+                    size_t zpp_flash_size,
+                    std::span<uint8_t const, 4uz> developer_code,
+                    uint32_t addr,
+                    std::span<uint8_t const> bytes,
+                    bool reset_cvs) {
+      { ct.zppValid(zpp_id, zpp_flash_size) } -> std::same_as<bool>;
+      { ct.loadCodeValid(developer_code) } -> std::same_as<bool>;
+      { t.eraseZpp(addr, addr) } -> std::same_as<bool>;
+      { t.writeZpp(addr, bytes) } -> std::same_as<bool>;
+      { t.endZpp() } -> std::same_as<bool>;
+      t.exitZpp(reset_cvs);
+    };
+  }
+
+private:
+  /// Downcast to type implementing the callbacks
+  ///
+  /// \return Reference to T
+  T& impl() { return static_cast<T&>(*this); }
+
+  /// Downcast to type implementing the callbacks
+  ///
+  /// \return Reference to T
+  T const& impl() const { return static_cast<T const&>(*this); }
+
+  /// Stream chunk of ZppUpdate payload if T implements streamZpp
+  ///
+  /// \param  addr  Address
+  /// \param  bytes Bytes
+  void streamPayload(uint32_t addr, std::span<uint8_t const> bytes) {
+    if constexpr (requires { impl().streamZpp(addr, bytes); })
+      impl().streamZpp(addr, bytes);
+  }
+
+  /// Commit ZppUpdate payload, falls back to writeZpp
+  ///
+  /// \param  addr  Address
+  /// \param  bytes Bytes
+  /// \retval true  Success
+  /// \retval false Failure
+  bool commitPayload(uint32_t addr, std::span<uint8_t const> bytes) {
+    if constexpr (requires { impl().commitZpp(addr, bytes); })
+      return impl().commitZpp(addr, bytes);
+    else return impl().writeZpp(addr, bytes);
+  }
+
+  /// Abort streamed ZppUpdate payload if T implements abortZpp
+  ///
+  /// \param  addr  Address
+  void abortPayload(uint32_t addr) {
+    if constexpr (requires { impl().abortZpp(addr); }) impl().abortZpp(addr);
+  }
+
+  /// Execute ZppValidQuery command
+  ///
+  /// \param  zpp_id          ZPP ID
+  /// \param  zpp_flash_size  ZPP flash size
+  /// \retval true            Transmit ackbit in channel2
+  /// \retval false           Do not transmit ackbit in channel2
+  bool executeValidQuery(std::string_view zpp_id, size_t zpp_flash_size) {
+    _zpp_valid = impl().zppValid(zpp_id, zpp_flash_size);
+    return !_zpp_valid;
+  }
+
+  /// Execute ZppLcDcQuery command
+  ///
+  /// \param  developer_code  Developer code
+  /// \retval true            Transmit ackbit in channel2
+  /// \retval false           Do not transmit ackbit in channel2
+  bool executeLcDcQuery(std::span<uint8_t const, 4uz> developer_code) const {
+    bool const valid{impl().loadCodeValid(developer_code)};
+    return !valid;
+  }
+
+  /// Execute ZppErase command
+  ///
+  /// \param  begin_addr  Begin address
+  /// \param  end_addr    End address
+  /// \retval true        Transmit ackbit in channel2
+  /// \retval false       Do not transmit ackbit in channel2
+  bool executeErase(uint32_t begin_addr, uint32_t end_addr) {
+    _addrs_valid = false;
+    _first_addr.reset();
+    _last_addr.reset();
+    auto const success{impl().eraseZpp(begin_addr, end_addr)};
+    return !success;
+  }
+
+  /// Execute ZppUpdate command
+  ///
+  /// \param  addr  Address
+  /// \param  bytes Bytes
+  /// \retval true  Transmit ackbit in channel2
+  /// \retval false Do not transmit ackbit in channel2
+  bool executeUpdate(uint32_t addr, std::span<uint8_t const> bytes) {
+    if (!_first_addr) _first_addr = addr;
+    // Lost packet
+    if (_last_addr && _last_addr < addr) {
+      abortPayload(addr);
+      return true;
+    }
+    // Already written
+    if (_last_addr && _last_addr > addr) {
+      abortPayload(addr);
+      return false;
+    }
+    if (commitPayload(addr, bytes)) {
+      _last_addr = addr + std::size(bytes);
+      return false;
+    }
+    return true;
+  }
 
-  bool execute(Command cmd, Packet const& packet, uint32_t);
+  /// Execute ZppUpdateEnd command
+  ///
+  /// \param  begin_addr  Begin address
+  /// \param  end_addr    End address
+  /// \retval true        Transmit ackbit in channel2
+  /// \retval false       Do not transmit ackbit in channel2
+  bool executeEnd(uint32_t begin_addr, uint32_t end_addr) {
+    if (!_first_addr || !_last_addr) return false;
+    _addrs_valid = begin_addr == _first_addr && end_addr == _last_addr;
+    if (!_addrs_valid) return true;
+    _first_addr = _last_addr = {};
+    auto const success{impl().endZpp()};
+    return !success;
+  }
+
+  /// Execute ZppExit or ZppExitReset command
+  ///
+  /// \param  reset_cvs Reset CVs
+  /// \retval true      Transmit ackbit in channel2
+  /// \retval false     Do not transmit ackbit in channel2
+  bool executeExit(bool reset_cvs) {
+    if (_addrs_valid || (!_first_addr && !_last_addr)) {
+      impl().exitZpp(reset_cvs);
+      return false;
+    }
+    while (!impl().eraseZpp(*_first_addr, *_last_addr));
+    _first_addr = _last_addr = {};
+    return true;
+  }
+
+  std::optional<uint32_t> _first_addr{};
+  std::optional<uint32_t> _last_addr{};
+  bool _addrs_valid : 1 {};
+  bool _zpp_valid : 1 {};
+  uint32_t _stream_addr{}; ///< Address of ZppUpdate packet being streamed
+  bool _streaming{};       ///< Receive only, not shared with bitfield above
+};
+
+/// Virtual ZPP callbacks
+///
+/// Base derives from these to bind the callbacks of Zpp to virtual functions.
+struct ZppCallbacks {
+  /// Dtor
+  virtual constexpr ~ZppCallbacks() = default;
 
 private:
+  template<typename>
+  friend struct Zpp;
+
   /// Check if ZPP is valid
   ///
   /// \param  zpp_id          ZPP ID
@@ -60,6 +335,43 @@ private:
   /// \retval false Failure
   virtual bool writeZpp(uint32_t addr, std::span<uint8_t const> bytes) = 0;
 
+  /// Stream chunk of ZppUpdate payload
+  ///
+  /// Called from receive (interrupt context) while the packet is still in
+  /// flight, so chunks can already be programmed into a flash buffer. Chunks
+  /// only become valid once commitZpp gets called for the same address, which
+  /// might overlap with streaming of the next packet.
+  ///
+  /// \param  addr  Address
+  /// \param  bytes Bytes
+  virtual void streamZpp([[maybe_unused]] uint32_t addr,
+                         [[maybe_unused]] std::span<uint8_t const> bytes) {}
+
+  /// Commit ZppUpdate payload
+  ///
+  /// Called from execute instead of writeZpp once CRC32 and address of the
+  /// packet have been checked. Payload which has been streamed before is
+  /// contained in bytes as well.
+  ///
+  /// \param  addr  Address
+  /// \param  bytes Bytes
+  /// \retval true  Success
+  /// \retval false Failure
+  virtual bool commitZpp(uint32_t addr, std::span<uint8_t const> bytes) {
+    return writeZpp(addr, bytes);
+  }
+
+  /// Abort streamed ZppUpdate payload
+  ///
+  /// Called from receive (interrupt context) if a streamed packet turned out to
+  /// be invalid, or from execute if a valid packet doesn't get committed (e.g.
+  /// repeated or lost packets). Every streamed packet thus ends in either
+  /// commitZpp or abortZpp. Packets too short to be streamed might end here
+  /// too, addresses which weren't streamed must be ignored.
+  ///
+  /// \param  addr  Address
+  virtual void abortZpp([[maybe_unused]] uint32_t addr) {}
+
   /// Update done
   ///
   /// \retval true  Success
@@ -70,18 +382,6 @@ private:
   ///
   /// \param  reset_cvs Reset CVs
   [[noreturn]] virtual void exitZpp(bool reset_cvs) = 0;
-
-  bool executeValidQuery(std::string_view zpp_id, size_t zpp_size);
-  bool executeLcDcQuery(std::span<uint8_t const, 4uz> developer_code) const;
-  bool executeErase(uint32_t begin_addr, uint32_t end_addr);
-  bool executeUpdate(uint32_t addr, std::span<uint8_t const> bytes);
-  bool executeEnd(uint32_t begin_addr, uint32_t end_addr);
-  bool executeExit(bool reset);
-
-  std::optional<uint32_t> _first_addr{};
-  std::optional<uint32_t> _last_addr{};
-  bool _addrs_valid : 1 {};
-  bool _zpp_valid : 1 {};
 };
 
 } // namespace mdu::rx::mixin
@@ -10,26 +10,41 @@
 
 #pragma once
 
+#include <array>
+#include <concepts>
+#include <cstddef>
 #include <cstdint>
 #include <optional>
 #include <span>
+#include <utility>
 #include "../../command.hpp"
 #include "../../crc32.hpp"
-#include "../../packet.hpp"
 #include "../../utility.hpp"
 
 namespace mdu::rx::mixin {
 
+struct ZsuCallbacks;
+
 /// Provides ZSU update logic
+///
+/// Calls the ZSU callbacks of the type to downcast to directly. Base binds them
+/// to the virtual functions of ZsuCallbacks.
+///
+/// \tparam T Type to downcast to
+template<typename T>
 struct Zsu {
+  /// Virtual callbacks used by Base
+  using Callbacks = ZsuCallbacks;
+
   /// Ctor
   ///
   /// \param  salsa20_master_key  Salsa20 master key
   explicit constexpr Zsu(char const* salsa20_master_key)
     : _salsa20_master_key{salsa20_master_key} {}
 
-  /// Dtor
-  virtual constexpr ~Zsu() = default;
+  /// Largest packet (ZsuUpdate)
+  static constexpr size_t max_packet_size{sizeof(Command) + sizeof(uint32_t) +
+                                          64uz + sizeof(Crc32)};
 
   /// Execute ZSU commands
   ///
@@ -38,7 +53,9 @@ struct Zsu {
   /// \param  decoder_id  Decoder ID
   /// \retval true        Transmit ackbit in channel2
   /// \retval false       Do not transmit ackbit in channel2
-  bool execute(Command cmd, Packet const& packet, uint32_t decoder_id) {
+  bool execute(Command cmd,
+               std::span<uint8_t const> packet,
+               uint32_t decoder_id) {
     switch (cmd) {
       case Command::ZsuSalsa20IV: {
         std::span<uint8_t const, 8uz> iv{&packet[4uz], 8uz};
@@ -55,7 +72,8 @@ struct Zsu {
                               sizeof(Crc32)};
         assert(bytes_size == 64uz);
         std::span<uint8_t const, 64uz> bytes{&packet[8uz], 64uz};
-        return executeUpdate(address, bytes);
+        auto const crc32{data2uint32(&packet[8uz + bytes_size])};
+        return executeUpdate(address, bytes, crc32);
       }
       case Command::ZsuCrc32Start: {
         auto const begin_addr{data2uint32(&packet[4uz])};
@@ -69,26 +87,24 @@ struct Zsu {
     }
   }
 
-private:
-  /// Erase ZSU in the closed-interval [begin_addr, end_addr[
+protected:
+  /// Check if type to downcast to implements the ZSU callbacks
   ///
-  /// \param  begin_addr  Begin address
-  /// \param  end_addr    End address
-  /// \retval true        Success
-  /// \retval false       Failure
-  virtual bool eraseZsu(uint32_t begin_addr, uint32_t end_addr) = 0;
+  /// \retval true  T implements the callbacks
+  /// \retval false T doesn't implement the callbacks
+  static consteval bool callbacks() {
+    return requires(T& t, uint32_t addr, std::span<uint8_t const, 64uz> bytes) {
+      { t.eraseZsu(addr, addr) } -> std::same_as<bool>;
+      { t.writeZsu(addr, bytes) } -> std::same_as<bool>;
+      t.exitZsu();
+    };
+  }
 
-  /// Write ZSU
+private:
+  /// Downcast to type implementing the callbacks
   ///
-  /// \param  addr  Address
-  /// \param  bytes Bytes
-  /// \retval true  Success
-  /// \retval false Failure
-  virtual bool writeZsu(uint32_t addr,
-                        std::span<uint8_t const, 64uz> bytes) = 0;
-
-  /// Exit ZSU
-  [[noreturn]] virtual void exitZsu() = 0;
+  /// \return Reference to T
+  T& impl() { return static_cast<T&>(*this); }
 
   /// Execute ZsuSalsa20IV command
   ///
@@ -108,11 +124,11 @@ private:
   /// \retval true        Transmit ackbit in channel2
   /// \retval false       Do not transmit ackbit in channel2
   bool executeErase(uint32_t begin_addr, uint32_t end_addr) {
-    _crc32.reset();
+    _crc32 = crc32({});
     _first_addr.reset();
     _last_addr.reset();
     _crc32valid = false;
-    auto const success{eraseZsu(begin_addr, end_addr)};
+    auto const success{impl().eraseZsu(begin_addr, end_addr)};
     return !success;
   }
 
@@ -120,9 +136,12 @@ private:
   ///
   /// \param  addr  Address
   /// \param  bytes Bytes
+  /// \param  crc   CRC32 of packet
   /// \retval true  Transmit ackbit in channel2
   /// \retval false Do not transmit ackbit in channel2
-  bool executeUpdate(uint32_t addr, std::span<uint8_t const, 64uz> bytes) {
+  bool executeUpdate(uint32_t addr,
+                     std::span<uint8_t const, 64uz> bytes,
+                     uint32_t crc) {
     if (!_first_addr) _first_addr = addr;
     // Lost packet
     if (_last_addr && _last_addr < addr) return true;
@@ -131,14 +150,37 @@ private:
     std::array<uint8_t, std::size(bytes)> decrypted_bytes;
     ECRYPT_decrypt_bytes(
       &_ctx, std::data(bytes), data(decrypted_bytes), size(decrypted_bytes));
-    if (writeZsu(addr, decrypted_bytes)) {
+    if (impl().writeZsu(addr, decrypted_bytes)) {
       _last_addr = addr + size(decrypted_bytes);
-      _crc32.next(bytes);
+      _crc32 = nextCrc32(addr, crc);
       return false;
     }
     return true;
   }
 
+  /// Append bytes of ZsuUpdate packet to CRC32
+  ///
+  /// Instead of a second pass over the bytes, the CRC32 of the packet (which
+  /// has already been checked during reception) is reused. The packet CRC
+  /// covers command, address and bytes. Combining the running CRC with the
+  /// packet CRC and removing command and address leaves the CRC of all bytes
+  /// received so far.
+  ///
+  /// \param  addr  Address
+  /// \param  crc   CRC32 of packet
+  /// \return CRC32 of all bytes including the ones of this packet
+  uint32_t nextCrc32(uint32_t addr, uint32_t crc) const {
+    // CRC32 of command followed by address 0
+    static constexpr auto cmd_crc{[] {
+      std::array<uint8_t, sizeof(Command) + sizeof(addr)> bytes{};
+      uint32_2data(std::to_underlying(Command::ZsuUpdate), data(bytes));
+      return crc32(bytes);
+    }()};
+    static constexpr auto xpow512{detail::crc32_xpow8n(64uz)};
+    auto const hdr_crc{cmd_crc ^ detail::crc32_finalize(addr)};
+    return detail::crc32_multiply(_crc32 ^ hdr_crc, xpow512) ^ crc;
+  }
+
   /// Execute ZsuCrc32Start command
   ///
   /// \param  begin_addr  Begin address
@@ -161,17 +203,49 @@ private:
   /// \retval false Do not transmit ackbit in channel2
   bool executeCrc32Result(bool exit) {
     if (exit && _crc32valid) {
-      exitZsu();
+      impl().exitZsu();
       return false;
     } else return !_crc32valid;
   }
 
   char const* _salsa20_master_key;
-  Crc32 _crc32{};
+  uint32_t _crc32{crc32({})};
   ECRYPT_ctx _ctx{};
   std::optional<uint32_t> _first_addr{};
   std::optional<uint32_t> _last_addr{};
   bool _crc32valid{};
 };
 
+/// Virtual ZSU callbacks
+///
+/// Base derives from these to bind the callbacks of Zsu to virtual functions.
+struct ZsuCallbacks {
+  /// Dtor
+  virtual constexpr ~ZsuCallbacks() = default;
+
+private:
+  template<typename>
+  friend struct Zsu;
+
+  /// Erase ZSU in the closed-interval [begin_addr, end_addr[
+  ///
+  /// \param  begin_addr  Begin address
+  /// \param  end_addr    End address
+  /// \retval true        Success
+  /// \retval false       Failure
+  virtual bool eraseZsu(uint32_t begin_addr, uint32_t end_addr) = 0;
+
+  /// Write ZSU
+  ///
+  /// \param  addr  Address
+  /// \param  bytes Bytes
+  /// \retval true  Success
+  /// \retval false Failure
+  virtual bool writeZsu(uint32_t addr,
+                        std::span<uint8_t const, 64uz> bytes) = 0;
+
+  /// Exit ZSU
+  [[noreturn]] virtual void exitZsu() = 0;
+};
+
 } // namespace mdu::rx::mixin
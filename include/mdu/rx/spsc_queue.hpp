@@ -0,0 +1,125 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// Single-producer/single-consumer queue
+///
+/// \file   mdu/rx/spsc_queue.hpp
+/// \author Vincent Hamp
+/// \date   18/10/2026
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+
+namespace mdu::rx {
+
+/// Single-producer/single-consumer queue
+///
+/// Ring buffer of N slots which holds at most N-1 elements. The remaining slot
+/// past the last element is owned by the producer, which fills it in place and
+/// then publishes it with push_back. The consumer reads front and releases it
+/// with pop_front. Each index is only ever written by one side and published
+/// with release semantics, so receive and execute can run in different
+/// contexts (interrupt, thread or core) without a lock.
+///
+/// \tparam T Type of elements
+/// \tparam N Number of slots
+template<typename T, size_t N>
+requires(N >= 2uz)
+struct SpscQueue {
+  using value_type = T;
+  using size_type = size_t;
+
+  /// Maximum number of slots
+  ///
+  /// \return N
+  static constexpr size_type max_size() { return N; }
+
+  /// Access first element (consumer)
+  ///
+  /// \return First element
+  T& front() {
+    assert(!empty(*this));
+    return _slots[_head.load(std::memory_order_relaxed)];
+  }
+
+  /// Access first element (consumer)
+  ///
+  /// \return First element
+  T const& front() const {
+    assert(!empty(*this));
+    return _slots[_head.load(std::memory_order_relaxed)];
+  }
+
+  /// Release first element (consumer)
+  void pop_front() {
+    assert(!empty(*this));
+    auto const head{_head.load(std::memory_order_relaxed)};
+    _head.store(next(head), std::memory_order_release);
+  }
+
+  /// Publish slot past the last element (producer)
+  void push_back() {
+    assert(size(*this) < N - 1uz);
+    auto const tail{_tail.load(std::memory_order_relaxed)};
+    _tail.store(next(tail), std::memory_order_release);
+  }
+
+  /// Slot past the last element which the producer fills next
+  ///
+  /// \param  q Queue
+  /// \return Pointer to slot
+  friend T* end(SpscQueue& q) {
+    return &q._slots[q._tail.load(std::memory_order_relaxed)];
+  }
+
+  /// Slot past the last element which the producer fills next
+  ///
+  /// \param  q Queue
+  /// \return Pointer to slot
+  friend T const* end(SpscQueue const& q) {
+    return &q._slots[q._tail.load(std::memory_order_relaxed)];
+  }
+
+  /// Slot past the last element which the producer fills next
+  ///
+  /// \param  q Queue
+  /// \return Pointer to slot
+  friend T const* cend(SpscQueue const& q) { return end(q); }
+
+  /// Number of elements
+  ///
+  /// \param  q Queue
+  /// \return Number of elements
+  friend size_type size(SpscQueue const& q) {
+    auto const head{q._head.load(std::memory_order_acquire)};
+    auto const tail{q._tail.load(std::memory_order_acquire)};
+    return (tail + N - head) % N;
+  }
+
+  /// Check whether queue is empty
+  ///
+  /// \param  q     Queue
+  /// \retval true  Queue is empty
+  /// \retval false Queue is not empty
+  friend bool empty(SpscQueue const& q) { return !size(q); }
+
+private:
+  /// Next index
+  ///
+  /// \param  i Index
+  /// \return Index following i
+  static constexpr size_type next(size_type i) {
+    return i + 1uz < N ? i + 1uz : 0uz;
+  }
+
+  std::array<T, N> _slots{};
+  std::atomic<size_type> _head{}; ///< Written by consumer only
+  std::atomic<size_type> _tail{}; ///< Written by producer only
+};
+
+} // namespace mdu::rx
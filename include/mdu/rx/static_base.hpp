@@ -0,0 +1,730 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// Receive base bound at compile time
+///
+/// \file   mdu/rx/static_base.hpp
+/// \author Vincent Hamp
+/// \date   18/10/2026
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <functional>
+#include <span>
+#include <utility>
+#include <gsl/util>
+#include <ztl/inplace_vector.hpp>
+#include "../bit.hpp"
+#include "../crc32.hpp"
+#include "../crc8.hpp"
+#include "../packet.hpp"
+#include "ack_pulse.hpp"
+#include "binary_tree_search.hpp"
+#include "config.hpp"
+#include "histogram.hpp"
+#include "mixin/executable.hpp"
+#include "mixin/zpp.hpp"
+#include "mixin/zsu.hpp"
+#include "spsc_queue.hpp"
+#include "statistics.hpp"
+
+namespace mdu::rx {
+
+// At least one packet to receive and one to execute
+static_assert(MDU_RX_DEQUE_SIZE >= 2u);
+
+// Queue holds one ack pulse less than its size
+static_assert(MDU_RX_ACK_QUEUE_SIZE != 1u);
+
+/// Receive base bound at compile time
+///
+/// Calls ackbit, readCv, writeCv and the callbacks of the mixins (writeZpp,
+/// eraseZsu, ...) of the type to downcast to directly instead of through a
+/// vtable, so that e.g. ackbit or streamZpp can be inlined into receive.
+///
+/// \tparam T     Type to downcast to
+/// \tparam Ts... Templates of mixins, instantiated with T
+template<typename T, template<typename> typename... Ts>
+requires(mixin::Executable<Ts<T>> && ...)
+struct StaticBase : Ts<T>... {
+  friend T;
+
+  /// Largest packet, either of the mixins or of the general commands (ping)
+  static constexpr size_t max_packet_size{std::min<size_t>(
+    MDU_MAX_PACKET_SIZE,
+    std::max({sizeof(Command) + 2uz * sizeof(uint32_t) + sizeof(Crc8),
+              Ts<T>::max_packet_size...}))};
+
+  /// Packet buffer only as large as the largest packet
+  using Packet = ztl::inplace_vector<uint8_t, max_packet_size>;
+
+  /// Ctor
+  ///
+  /// \param  cfg Confiuration
+  explicit constexpr StaticBase(Config cfg) : _cfg{cfg} {
+    static_assert(callbacks(), "T must implement ackbit, readCv and writeCv");
+    static_assert((Ts<T>::callbacks() && ...),
+                  "T must implement the callbacks of the mixins");
+  }
+
+  /// Ctor
+  ///
+  /// \param  cfg                 Confiuration
+  /// \param  salsa20_master_key  Salsa20 master key
+  explicit constexpr StaticBase(Config cfg, char const* salsa20_master_key)
+    : mixin::Zsu<T>{salsa20_master_key}, _cfg{cfg} {
+    static_assert(callbacks(), "T must implement ackbit, readCv and writeCv");
+    static_assert((Ts<T>::callbacks() && ...),
+                  "T must implement the callbacks of the mixins");
+  }
+
+  /// Encoding of commands bit by bit
+  ///
+  /// \param  time  Time in µs
+  void receive(uint32_t time) {
+    auto const scaled_time{scale(time)};
+    auto const bit{time2bit(scaled_time, transferRateIndex())};
+    if (bit == Invalid) count(&Statistics::invalid_bits);
+#if MDU_RX_ACK_QUEUE_SIZE
+    if constexpr (queuesAckPulses()) _time += time;
+#endif
+#if MDU_RX_HISTOGRAM_BINS
+    _histogram.add(time, bit);
+#endif
+    if (bit == Ackreq) _state = State::Ackreq; // Shortcut to ackreq phase
+#if MDU_RX_SWITCH_STATE_MACHINE
+    switch (_state) {
+      case State::Preamble: return preamble(scaled_time, bit);
+      case State::Data: return data(scaled_time, bit);
+      case State::Endbit: return endbit(scaled_time, bit);
+      case State::Ackreq: return ackreq(scaled_time, bit);
+    }
+#else
+    static constexpr std::array states{&StaticBase::preamble,
+                                       &StaticBase::data,
+                                       &StaticBase::endbit,
+                                       &StaticBase::ackreq};
+    std::invoke(states[std::to_underlying(_state)], this, scaled_time, bit);
+#endif
+  }
+
+  /// Encoding of commands from a buffer of times
+  ///
+  /// Convenience wrapper which calls receive for every time. It saves a call
+  /// per edge at most, the decoder state still gets loaded and stored for each
+  /// of them.
+  ///
+  /// \param  times Times in µs
+  void receive(std::span<uint32_t const> times) {
+    for (auto const time : times) receive(time);
+  }
+
+  /// Get active status (MDU is active when at least one preamble was received)
+  ///
+  /// \retval true  MDU active
+  /// \retval false MDU not active
+  bool active() const { return _active.load(std::memory_order_relaxed); }
+
+#if MDU_RX_STATISTICS
+  /// Get statistics
+  ///
+  /// \return Statistics
+  Statistics const& statistics() const { return _statistics; }
+#endif
+
+#if MDU_RX_HISTOGRAM_BINS
+  /// Get histogram of received times
+  ///
+  /// \return Histogram
+  auto const& histogram() const { return _histogram; }
+#endif
+
+#if MDU_RX_ACK_QUEUE_SIZE
+  /// Get queue of ack pulses to generate
+  ///
+  /// Only filled for decoders which opt in with queue_ack_pulses. Pulses are
+  /// consumed with front and pop_front.
+  ///
+  /// \return Queue of ack pulses
+  auto& ackPulses() { return _ack_pulses; }
+#endif
+
+  /// Execute
+  void execute() {
+    if (empty(_deque)) return;
+    auto const& packet{_deque.front()};
+    auto const command{packet2command(packet)};
+
+    // Pop deque on exit
+    gsl::final_action pop_deque{[this] { _deque.pop_front(); }};
+
+    // Ping must always work, even when not selected
+    if (command == Command::Ping) {
+      countExecuted(command);
+      return executePing(packet);
+    }
+
+    // A ping still pending during reception might have deselected the decoder
+    if (!selected()) return abortStream(packet);
+    countExecuted(command);
+
+    switch (command) {
+      case Command::ConfigTransferRate: {
+        auto const transfer_rate{static_cast<TransferRate>(packet[4uz])};
+        return executeConfigTransferRate(transfer_rate);
+      }
+      case Command::BinaryTreeSearch: {
+        uint32_t const pos{packet[4uz]};
+        return executeBinaryTreeSearch(pos);
+      }
+      case Command::CvRead: [[fallthrough]];
+      case Command::CvWrite: {
+        auto const number{data2uint16(&packet[4uz])};
+        assert(number > 0u);
+        auto const addr{number - 1u};
+        auto const value{packet[6uz]};
+        return command == Command::CvRead ? executeCvRead(addr, value)
+                                          : executeCvWrite(addr, value);
+      }
+      default: {
+        auto const mixins_ack{
+          (Ts<T>::execute(command, packet, _cfg.decoder_id) || ...)};
+        return ack(mixins_ack);
+      }
+    }
+  }
+
+protected:
+  /// States of receiving a packet
+  ///
+  /// Depending on MDU_RX_SWITCH_STATE_MACHINE the current state is either
+  /// dispatched by a switch, which allows the compiler to inline the handlers,
+  /// or through a table of member function pointers.
+  enum class State : uint8_t { Preamble, Data, Endbit, Ackreq };
+
+  /// Check if type to downcast to implements the callbacks
+  ///
+  /// Checked from within StaticBase instead of by a concept, since StaticBase
+  /// is a friend of T and has access to callbacks which aren't public. Instead
+  /// of implementing ackbit T may opt in to queue ack pulses.
+  ///
+  /// \retval true  T implements the callbacks
+  /// \retval false T doesn't implement the callbacks
+  static consteval bool callbacks() {
+    return requires(
+             T& t, T const& ct, uint32_t cv_addr, uint32_t pos, uint8_t byte) {
+      { ct.readCv(cv_addr, pos) } -> std::same_as<bool>;
+      { t.writeCv(cv_addr, byte) } -> std::same_as<bool>;
+    } && (queuesAckPulses() ? MDU_RX_ACK_QUEUE_SIZE > 0u
+                            : requires(T const& ct, uint32_t us) {
+                                { ct.ackbit(us) } -> std::same_as<void>;
+                              });
+  }
+
+  /// Check if type to downcast to queues ack pulses instead of calling ackbit
+  ///
+  /// T opts in with a static constexpr bool queue_ack_pulses{true} member.
+  ///
+  /// \retval true  T queues ack pulses
+  /// \retval false T implements ackbit
+  static consteval bool queuesAckPulses() {
+    if constexpr (requires { T::queue_ack_pulses; })
+      return T::queue_ack_pulses;
+    else return false;
+  }
+
+  /// Downcast to type implementing the callbacks
+  ///
+  /// \return Reference to T
+  T& impl() { return static_cast<T&>(*this); }
+
+  /// Downcast to type implementing the callbacks
+  ///
+  /// \return Reference to T
+  T const& impl() const { return static_cast<T const&>(*this); }
+
+  /// Wait for preamble
+  ///
+  /// \param  time  Time in µs
+  /// \param  bit   Bit
+  void preamble([[maybe_unused]] uint32_t time, Bit bit) {
+    // Preamble can only set nack, never clear it
+    if (bit == 1u) {
+      nack(++_bit_count >= 2uz || nack());
+#if MDU_RX_CALIBRATE_PREAMBLE
+      average(time);
+#endif
+    } else if (_bit_count < MDU_RX_MIN_PREAMBLE_BITS) reset();
+    else {
+#if MDU_RX_CALIBRATE_PREAMBLE
+      calibrate();
+#endif
+      _bit_count = 0uz;
+      active(true);
+      _state = State::Data;
+    }
+  }
+
+  /// Receive data
+  ///
+  /// \param  bit Bit
+  void data(uint32_t, Bit bit) {
+    if (bit > 1u) {
+      count(&Statistics::data_resets);
+      return reset();
+    } else if (!shiftIn(bit)) return;
+    else _state = State::Endbit;
+  }
+
+  /// Might be packet end
+  ///
+  /// \param  bit Bit
+  void endbit(uint32_t, Bit bit) {
+    if (!bit) {
+      _state = State::Data;
+      return;
+    } else if (bit != 1u) {
+      count(&Statistics::endbit_resets);
+      return reset();
+    }
+    auto const valid{!_drop && packetValid()};
+    if (valid) _deque.push_back();
+    endStream(valid);
+    _bit_count = 0u;
+    _state = State::Ackreq;
+  }
+
+  /// Ackreq phase
+  ///
+  /// \param  time  Time in µs
+  /// \param  bit   Bit
+  void ackreq(uint32_t time, Bit bit) {
+    if (!selected() || bit != Ackreq) return reset();
+    if (++_ackreqbit_count < 2uz) return;
+    // Channel1 (incomplete packages or CRC errors)
+    if (auto const& us{is_fallback_ackreq(time)
+                         ? fallback_timing
+                         : timings[transferRateIndex()]};
+        _ackreqbit_count >= 2uz && _ackreqbit_count <= 4uz) {
+      if (!nack()) return;
+      generateAckbit(us.ack);
+      count(&Statistics::channel1_ackbits);
+    }
+    // Channel2
+    else if (_ackreqbit_count >= 6uz && _ackreqbit_count <= 8uz) {
+      if (!ack()) return;
+      generateAckbit(us.ack);
+      count(&Statistics::channel2_ackbits);
+    }
+  }
+
+  /// Generate ackbit either by callback or by queuing an ack pulse
+  ///
+  /// \param  us  Length of pulse in µs
+  void generateAckbit(uint16_t us) {
+    if constexpr (!queuesAckPulses()) impl().ackbit(us);
+#if MDU_RX_ACK_QUEUE_SIZE
+    // Pulses which don't fit are lost, just like with a full deque
+    else if (size(_ack_pulses) < _ack_pulses.max_size() - 1uz) {
+      *end(_ack_pulses) = {.time = _time,
+                           .us = us,
+                           .period = _cfg.ack_pwm_period,
+                           .duty = _cfg.ack_pwm_duty};
+      _ack_pulses.push_back();
+    } else count(&Statistics::lost_ack_pulses);
+#endif
+  }
+
+#if MDU_RX_CALIBRATE_PREAMBLE
+  /// Update running average of preamble one bits
+  ///
+  /// Exponential moving average with a weight of 1/8 in 12.4 fixed-point. It
+  /// follows the most recent bits and can't overflow, no matter how long the
+  /// preamble (e.g. idle between packets) lasts.
+  ///
+  /// \param  time  Time in µs
+  void average(uint32_t time) {
+    auto const t{std::min<uint32_t>(time, UINT16_MAX) << 4u};
+    _preamble_avg = _bit_count == 1uz
+                      ? t
+                      : _preamble_avg - (_preamble_avg >> 3u) + (t >> 3u);
+  }
+
+  /// Calibrate to average one bit of preamble
+  ///
+  /// Until the next reset, times get scaled by the ratio of the nominal to the
+  /// measured one bit. This re-centres the windows on the timings actually
+  /// received, compensating for drift of the decoders oscillator. Preambles
+  /// whose average isn't a one bit of the current transfer rate (e.g. fallback
+  /// timings) leave times unscaled.
+  void calibrate() {
+    auto const& timing{timings[transferRateIndex()]};
+    auto const avg{_preamble_avg};
+    if (avg < static_cast<uint32_t>(timing.one_min << 4u) ||
+        avg > static_cast<uint32_t>(timing.one_max << 4u))
+      return;
+    _time_scale = static_cast<uint16_t>(
+      (static_cast<uint32_t>(timing.one) << (4u + time_scale_shift)) / avg);
+  }
+#endif
+
+  /// Scale time according to calibration
+  ///
+  /// \param  time  Time in µs
+  /// \return Scaled time in µs
+  uint32_t scale(uint32_t time) const {
+#if MDU_RX_CALIBRATE_PREAMBLE
+    return std::min<uint32_t>(time, UINT16_MAX) * _time_scale >>
+           time_scale_shift;
+#else
+    return time;
+#endif
+  }
+
+  /// Shift bit in
+  ///
+  /// \param  bit   Bit
+  /// \retval true  Byte done
+  /// \retval false Byte not yet done
+  bool shiftIn(uint32_t bit) {
+    assert(bit <= 1u);
+    _byte |= static_cast<decltype(_byte)>(bit << (7uz - _bit_count++));
+    if (_bit_count >= 8uz) {
+      if (auto& packet{*end(_deque)}; !_drop) {
+        // Packets exceeding the buffer can't be executed anyway, keep
+        // calculating the CRC to tell whether they were received correctly
+        if (size(packet) < packet.max_size()) packet.push_back(_byte);
+        else {
+          if (!_overflow) endStream(false); // Streamed chunks get aborted
+          _overflow = true;
+        }
+        crcNext(packet);
+        if (!_overflow) stream(packet);
+        _drop = dropEarly(packet);
+      }
+      _bit_count = _byte = 0u;
+    }
+    return !_bit_count;
+  }
+
+  /// Update the CRC the current packet requires
+  ///
+  /// The command is known once the first 4 bytes are in. Until then CRC8 gets
+  /// calculated, afterwards only either CRC8 or CRC32.
+  ///
+  /// \param  packet  Packet received so far
+  void crcNext(Packet const& packet) {
+    if (size(packet) > sizeof(Command)) {
+      if (_crc32_packet) _crc32.next(_byte);
+      else _crc8.next(_byte);
+      return;
+    }
+    _crc8.next(_byte);
+    if (size(packet) < sizeof(Command)) return;
+    auto const cmd{packet2command(packet)};
+    _crc32_packet = cmd == Command::ZsuUpdate || cmd == Command::ZppUpdate;
+    if (_crc32_packet) _crc32.next(packet);
+  }
+
+  /// Stream ZppUpdate payload while it's being received
+  ///
+  /// \param  packet  Packet received so far
+  void stream([[maybe_unused]] Packet const& packet) {
+#if MDU_RX_ZPP_STREAMING
+    if constexpr ((std::same_as<Ts<T>, mixin::Zpp<T>> || ...))
+      if (_crc32_packet && selected()) mixin::Zpp<T>::stream(packet);
+#endif
+  }
+
+  /// End streaming of ZppUpdate payload
+  ///
+  /// \param  valid Packet was received correctly
+  void endStream([[maybe_unused]] bool valid) {
+#if MDU_RX_ZPP_STREAMING
+    if constexpr ((std::same_as<Ts<T>, mixin::Zpp<T>> || ...))
+      mixin::Zpp<T>::endStream(valid);
+#endif
+  }
+
+  /// Abort stream of ZppUpdate packet which doesn't get executed
+  ///
+  /// \param  packet  Packet
+  void abortStream([[maybe_unused]] Packet const& packet) {
+#if MDU_RX_ZPP_STREAMING
+    if constexpr ((std::same_as<Ts<T>, mixin::Zpp<T>> || ...))
+      if (packet2command(packet) == Command::ZppUpdate)
+        mixin::Zpp<T>::abortStream(packet);
+#endif
+  }
+
+  /// Check if rest of packet can be dropped
+  ///
+  /// Once the command is in, packets other than ping which can't be executed
+  /// because the decoder isn't selected get dropped. Since a pending ping might
+  /// still select the decoder, this requires the deque to be empty.
+  ///
+  /// \param  packet  Packet received so far
+  /// \retval true    Drop packet
+  /// \retval false   Keep packet
+  bool dropEarly(Packet const& packet) const {
+    return size(packet) == sizeof(Command) && !selected() && empty(_deque) &&
+           packet2command(packet) != Command::Ping;
+  }
+
+  /// Reset
+  void reset() {
+    endStream(false);
+    end(_deque)->resize(0uz);
+    _bit_count = _ackreqbit_count = _byte = 0u;
+    _crc32_packet = _overflow = _drop = false;
+    ack(false);
+    _crc8.reset();
+    _crc32.reset();
+#if MDU_RX_CALIBRATE_PREAMBLE
+    _preamble_avg = 0u;
+    _time_scale = 1u << time_scale_shift;
+#endif
+    _state = State::Preamble;
+  }
+
+  /// Check busy, CRC and size
+  ///
+  /// \retval true  Packet valid
+  /// \retval false Packet not valid
+  bool packetValid() {
+    auto const deque_almost_full{size(_deque) >= _deque.max_size() - 1uz};
+    auto const command{packet2command(*cend(_deque))};
+    return !busy(command, deque_almost_full) && crcCheck(command) &&
+           !oversized();
+  }
+
+  /// Check if busy, setup nack/ack transmission
+  ///
+  /// \param  cmd               Command
+  /// \param  deque_almost_full Only 1 slot left in deque
+  /// \retval true              Busy
+  /// \retval false             Not busy
+  bool busy(Command cmd, bool deque_almost_full) {
+    if (cmd == Command::Busy) {
+      nack(_crc8);
+      if (!_crc8) ack(deque_almost_full);
+    }
+    if (deque_almost_full) count(&Statistics::busy);
+    return deque_almost_full;
+  }
+
+  /// Check if CRC is valid, setup nack/ack transmission
+  ///
+  /// \param  cmd   Command
+  /// \retval true  CRC is valid
+  /// \retval false CRC is not valid
+  bool crcCheck(Command cmd) {
+    uint32_t crc;
+    // Commands with CRC32 also transmit failures in channel2
+    if (cmd == Command::ZsuUpdate || cmd == Command::ZppUpdate) {
+      crc = _crc32.state();
+      ack(crc);
+      if (crc) count(&Statistics::crc32_errors);
+    } else {
+      crc = _crc8;
+      // And there's also an exception for ZsuSalsa20IV...
+      if (cmd == Command::ZsuSalsa20IV) ack(crc);
+      if (crc) count(&Statistics::crc8_errors);
+    }
+    nack(crc);
+    return !crc;
+  }
+
+  /// Check if packet exceeded buffer
+  ///
+  /// Packets exceeding the buffer are commands none of the mixins executes
+  /// (e.g. ZPP updates meant for other decoders). They are not nacked, which
+  /// would otherwise force the command station to repeat them.
+  ///
+  /// \retval true  Packet exceeded buffer
+  /// \retval false Packet fit into buffer
+  bool oversized() {
+    if (_overflow) count(&Statistics::oversized);
+    return _overflow;
+  }
+
+  /// Count statistics event
+  ///
+  /// \param  counter Counter to increment
+  void count([[maybe_unused]] Statistics::Counter Statistics::* counter) {
+#if MDU_RX_STATISTICS
+    Statistics::increment(_statistics.*counter);
+#endif
+  }
+
+  /// Count executed packet
+  ///
+  /// \param  cmd Command
+  void countExecuted([[maybe_unused]] Command cmd) {
+#if MDU_RX_STATISTICS
+    Statistics::increment(_statistics.executed[Statistics::index(cmd)]);
+#endif
+  }
+
+  /// Set active status
+  ///
+  /// \param  active  Active
+  void active(bool active) {
+    _active.store(active, std::memory_order_relaxed);
+  }
+
+  /// Get selected status
+  ///
+  /// \retval true  Decoder selected
+  /// \retval false Decoder not selected
+  bool selected() const {
+    return _selected.load(std::memory_order_acquire);
+  }
+
+  /// Set selected status
+  ///
+  /// \param  selected  Selected
+  void select(bool selected) {
+    _selected.store(selected, std::memory_order_release);
+  }
+
+  /// Get nack status
+  ///
+  /// \retval true  Transmit ackbit in channel1
+  /// \retval false Do not transmit ackbit in channel1
+  bool nack() const { return _nack.load(std::memory_order_acquire); }
+
+  /// Set nack status
+  ///
+  /// \param  nack  Nack
+  void nack(bool nack) { _nack.store(nack, std::memory_order_release); }
+
+  /// Get ack status
+  ///
+  /// \retval true  Transmit ackbit in channel2
+  /// \retval false Do not transmit ackbit in channel2
+  bool ack() const { return _ack.load(std::memory_order_acquire); }
+
+  /// Set ack status
+  ///
+  /// \param  ack Ack
+  void ack(bool ack) { _ack.store(ack, std::memory_order_release); }
+
+  /// Get transfer rate index
+  ///
+  /// \return Index of current transfer rate
+  size_t transferRateIndex() const {
+    return _transfer_rate_index.load(std::memory_order_relaxed);
+  }
+
+  /// Execute ping (short and long version)
+  ///
+  /// \param  packet  Packet
+  void executePing(Packet const& packet) {
+    uint32_t serial_number{};
+    uint32_t decoder_id{};
+    if (size(packet) < 9uz)
+      decoder_id = packet[4uz] ? static_cast<uint32_t>(packet[4uz] << 24u) |
+                                   (_cfg.decoder_id & 0x00FF'FFFFu)
+                               : 0u;
+    else {
+      serial_number = data2uint32(&packet[4uz]);
+      if (size(packet) >= 12uz) decoder_id = data2uint32(&packet[8uz]);
+    }
+    executePing(serial_number, decoder_id);
+  }
+
+  /// Execute ping
+  ///
+  /// \param  serial_number Serial number
+  /// \param  decoder_id    Decoder ID
+  void executePing(uint32_t serial_number, uint32_t decoder_id) {
+    // Set ack on exit
+    gsl::final_action set_ack{[this] { ack(selected()); }};
+    if (serial_number && decoder_id)
+      select(serial_number == _cfg.serial_number &&
+             decoder_id == _cfg.decoder_id);
+    else if (serial_number) select(serial_number == _cfg.serial_number);
+    else if (decoder_id) select(decoder_id == _cfg.decoder_id);
+    else select(true);
+  }
+
+  /// Execute config transfer rate
+  ///
+  /// \param  transfer_rate Transfer rate
+  void executeConfigTransferRate(TransferRate transfer_rate) {
+    if (transfer_rate < _cfg.transfer_rate) ack(true);
+    else if (auto const i{std::to_underlying(transfer_rate)}; i < size(timings))
+      _transfer_rate_index.store(static_cast<uint8_t>(i),
+                                 std::memory_order_relaxed);
+  }
+
+  /// Execute binary tree search
+  ///
+  /// \param  pos Bit position to test
+  void executeBinaryTreeSearch(uint32_t pos) {
+    bool const bit{
+      _binary_tree_search(_cfg.serial_number, _cfg.decoder_id, pos)};
+    ack(bit);
+  }
+
+  /// Execute CV read
+  ///
+  /// \param  cv_addr CV address
+  /// \param  pos     Bit position to test
+  void executeCvRead(uint32_t cv_addr, uint32_t pos) {
+    bool const bit{impl().readCv(cv_addr, pos)};
+    ack(bit);
+  }
+
+  /// Execute CV write
+  ///
+  /// \param  cv_addr CV address
+  /// \param  byte    CV value
+  void executeCvWrite(uint32_t cv_addr, uint8_t byte) {
+    bool const success{impl().writeCv(cv_addr, byte)};
+    ack(!success);
+  }
+
+  size_t _bit_count{};       ///< Count received bits
+  size_t _ackreqbit_count{}; ///< Count received ackreqbits
+#if MDU_RX_CALIBRATE_PREAMBLE
+  static constexpr auto time_scale_shift{12u};
+  /// Running average of preamble one bits (12.4 fixed-point)
+  uint32_t _preamble_avg{};
+  uint16_t _time_scale{1u << time_scale_shift}; ///< Fixed-point time scale
+#endif
+  Config const _cfg{};
+  Crc32 _crc32{};
+  SpscQueue<Packet, MDU_RX_DEQUE_SIZE> _deque{};
+  Crc8 _crc8;
+  std::atomic<uint8_t> _transfer_rate_index{
+    std::to_underlying(TransferRate::Default)};
+  uint8_t _byte{};
+  State _state{State::Preamble};
+  BinaryTreeSearch _binary_tree_search{};
+  std::atomic<bool> _selected{true};
+  std::atomic<bool> _active{};
+  std::atomic<bool> _nack{};
+  std::atomic<bool> _ack{};
+  bool _crc32_packet : 1 {}; ///< Current packet uses CRC32
+  bool _overflow : 1 {};     ///< Current packet exceeds buffer
+  bool _drop : 1 {};         ///< Current packet gets dropped
+#if MDU_RX_STATISTICS
+  Statistics _statistics{};
+#endif
+#if MDU_RX_HISTOGRAM_BINS
+  Histogram<MDU_RX_HISTOGRAM_BINS, MDU_RX_HISTOGRAM_BIN_WIDTH> _histogram{};
+#endif
+#if MDU_RX_ACK_QUEUE_SIZE
+  uint32_t _time{}; ///< Sum of all received times
+  SpscQueue<AckPulse, MDU_RX_ACK_QUEUE_SIZE> _ack_pulses{};
+#endif
+};
+
+} // namespace mdu::rx
@@ -0,0 +1,87 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// Receive statistics
+///
+/// \file   mdu/rx/statistics.hpp
+/// \author Vincent Hamp
+/// \date   18/10/2026
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include "../command.hpp"
+
+namespace mdu::rx {
+
+/// Receive statistics
+///
+/// Every counter is only ever written by either receive or execute, so a store
+/// of the incremented value suffices and doesn't require atomic
+/// read-modify-write instructions. Counters can be read at any time.
+struct Statistics {
+  using Counter = std::atomic<uint32_t>;
+
+  /// Commands with individual execution counters
+  static constexpr std::array commands{Command::Ping,
+                                       Command::ConfigTransferRate,
+                                       Command::BinaryTreeSearch,
+                                       Command::CvRead,
+                                       Command::CvWrite,
+                                       Command::Busy,
+                                       Command::ZsuSalsa20IV,
+                                       Command::ZsuErase,
+                                       Command::ZsuUpdate,
+                                       Command::ZsuCrc32Start,
+                                       Command::ZsuCrc32Result,
+                                       Command::ZsuCrc32ResultExit,
+                                       Command::ZppValidQuery,
+                                       Command::ZppLcDcQuery,
+                                       Command::ZppErase,
+                                       Command::ZppUpdate,
+                                       Command::ZppUpdateEnd,
+                                       Command::ZppExit,
+                                       Command::ZppExitReset};
+
+  /// Increment counter
+  ///
+  /// \param  counter Counter
+  static void increment(Counter& counter) {
+    counter.store(counter.load(std::memory_order_relaxed) + 1u,
+                  std::memory_order_relaxed);
+  }
+
+  /// Index of command
+  ///
+  /// \param  cmd Command
+  /// \return Index of command in executed (unknown commands share the last)
+  static constexpr size_t index(Command cmd) {
+    return static_cast<size_t>(std::ranges::find(commands, cmd) -
+                               cbegin(commands));
+  }
+
+  /// Get number of executed packets of command
+  ///
+  /// \param  cmd Command
+  /// \return Number of executed packets
+  uint32_t executedPackets(Command cmd) const { return executed[index(cmd)]; }
+
+  Counter invalid_bits{};     ///< Times classified as invalid
+  Counter data_resets{};      ///< Resets while receiving data
+  Counter endbit_resets{};    ///< Resets while waiting for endbit
+  Counter crc8_errors{};      ///< Packets with CRC8 error
+  Counter crc32_errors{};     ///< Packets with CRC32 error
+  Counter busy{};             ///< Packets rejected because deque was full
+  Counter oversized{};        ///< Packets rejected because they exceed buffer
+  Counter channel1_ackbits{}; ///< Ackbits transmitted in channel1
+  Counter channel2_ackbits{}; ///< Ackbits transmitted in channel2
+  Counter lost_ack_pulses{};  ///< Ack pulses lost because queue was full
+  std::array<Counter, size(commands) + 1uz> executed{}; ///< Executed packets
+};
+
+} // namespace mdu::rx
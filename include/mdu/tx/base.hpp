@@ -11,6 +11,8 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <span>
 #include <utility>
 #include "../packet.hpp"
@@ -19,6 +21,7 @@
 #include "channel.hpp"
 #include "command_station.hpp"
 #include "config.hpp"
+#include "run.hpp"
 #include "timings.hpp"
 #include "timings_adapter.hpp"
 
@@ -35,12 +38,17 @@ namespace mdu::tx {
 /// can be adjusted using Base::setTransferRate(). Both can only be done if MDU
 /// is not busy.
 ///
+/// Up to N packets can be queued. The next packet starts right after the ackreq
+/// phase of the current one, without any idle preamble in between. A single
+/// packet (N=1) starts right away and doesn't need any queue counters.
+///
 /// \tparam T Type to downcast to
 /// \tparam D Deque value type
 /// \arg      Packet  Calculate on-the-fly
 /// \arg      Timings Pre-calculate timings
-template<typename T, typename D = Packet>
-requires(std::same_as<D, Packet> || std::same_as<D, Timings>)
+/// \tparam N Number of packets which can be queued (including the current)
+template<typename T, typename D = Packet, size_t N = 1uz>
+requires((std::same_as<D, Packet> || std::same_as<D, Timings>) && N > 0uz)
 struct Base {
   friend T;
 
@@ -85,44 +93,47 @@ struct Base {
   ///
   /// \retval true  Idle
   /// \retval false Busy
-  bool isIdle() { return _iter == _last && _ackreq_count == _cfg.num_ackreq; }
+  bool isIdle() const { return !queued(); }
 
-  /// Set packet to transmit, transmitter must be idle
+  /// Set packet to transmit, queue must not be full
   ///
   /// \param  packet  Packet to transmit
   /// \retval true    Packet was enqueued
-  /// \retval false   Transmission ongoing
+  /// \retval false   Queue full
   bool packet(Packet const& packet) {
     return bytes({cbegin(packet), std::size(packet)});
   }
 
-  /// Set bytes to transmit, transmitter must be idle
+  /// Set bytes to transmit, queue must not be full
   ///
   /// \param  bytes Bytes to transmit
   /// \retval true  Packet was enqueued
-  /// \retval false Transmission ongoing
+  /// \retval false Queue full
   bool bytes(std::span<uint8_t const> bytes) {
-    // Only set packet when idle
-    if (!isIdle()) return false;
+    // Only set packet when there is a free slot
+    if (queued() >= N) return false;
     assert(std::size(bytes) <= MDU_MAX_PACKET_SIZE);
 
-    // Copy bytes into package
+    // Copy bytes into free slot
+    size_t tail{};
+    if constexpr (fifo()) tail = _counts.tail.load(std::memory_order_relaxed);
+    auto& packet{_packets[tail % N]};
     if constexpr (std::same_as<D, Packet>)
-      _packet = {bytes, _cfg, _transfer_rate};
+      packet = {bytes, _cfg, _transfer_rate};
     else {
       auto tmp{
         bytes2timings({std::begin(bytes), std::size(bytes)},
                       {.num_preamble = _cfg.num_preamble, .num_ackreq = 0u},
                       _transfer_rate)};
-      _packet.clear();
+      packet.clear();
       std::ranges::copy_n(
-        std::begin(tmp), std::size(tmp), std::back_inserter(_packet));
+        std::begin(tmp), std::size(tmp), std::back_inserter(packet));
     }
 
-    // Set iterators and reset ackreq counter
-    _iter = std::begin(_packet);
-    _last = std::cend(_packet);
-    _ackreq_count = 0uz;
+    // Publish slot
+    if constexpr (fifo())
+      _counts.tail.store(tail + 1uz, std::memory_order_release);
+    else start();
     return true;
   }
 
@@ -131,25 +142,165 @@ struct Base {
   /// \return Bit duration in µs
   Timings::value_type transmit() {
     toggleTrackOutputs();
-    if (_iter != _last) return packetTiming();
-    else if (_ackreq_count < _cfg.num_ackreq) return ackreqTiming();
-    else return timings[std::to_underlying(_transfer_rate)].one;
+    return nextTiming();
+  }
+
+  /// Fill buffer with next bit durations to transmit in µs
+  ///
+  /// Meant to feed a timer by DMA. Filling stops in front of every duration
+  /// whose transmission calls back to the command station during the ackreq
+  /// phase, so that the callback happens with the next call, i.e. once the
+  /// durations written so far have actually been transmitted. Outside of the
+  /// ackreq phase the buffer always gets filled completely. trackOutputs
+  /// doesn't get called, toggling the outputs is up to the hardware.
+  ///
+  /// \param  out Buffer to fill
+  /// \return Number of durations written
+  size_t transmit(std::span<uint16_t> out) {
+    if (std::empty(out)) return 0uz;
+    auto first{std::begin(out)};
+    do *first++ = nextTiming();
+    while (first != std::end(out) && !callsBack());
+    return static_cast<size_t>(first - std::begin(out));
+  }
+
+  /// Get next run of identical bit durations to transmit
+  ///
+  /// Meant for hardware which repeats a duration by itself (e.g. timer
+  /// repetition counters or RMT loop counts). Runs end in front of every
+  /// duration which calls back in the ackreq phase, the same way the buffer
+  /// of transmit(std::span<uint16_t>) does. trackOutputs doesn't get called.
+  ///
+  /// Runs are computed in advance. A packet queued while an idle run is being
+  /// transmitted only starts after that run, so it gets delayed by up to
+  /// max_count one bits. Keep max_count small (e.g. 256).
+  ///
+  /// \param  max_count Maximum number of bits of a run
+  /// \return Run
+  Run transmitRun(uint16_t max_count) {
+    assert(max_count);
+    Run run{.duration = nextTiming(), .count = 1u};
+    while (run.count < max_count && !callsBack() &&
+           peekTiming() == run.duration) {
+      nextTiming();
+      ++run.count;
+    }
+    return run;
   }
 
 private:
+  /// Counts of released and queued packets
+  struct Counts {
+    std::atomic<size_t> head{}; ///< Count of released packets (transmit only)
+    std::atomic<size_t> tail{}; ///< Count of queued packets (bytes only)
+  };
+
+  /// No counts for a single packet
+  struct NoCounts {};
+
   constexpr Base() = default;
   CommandStation auto& impl() { return static_cast<T&>(*this); }
   CommandStation auto const& impl() const {
     return static_cast<T const&>(*this);
   }
 
+  /// Next bit duration
+  ///
+  /// \return Bit duration in µs
+  Timings::value_type nextTiming() {
+    if constexpr (fifo())
+      if (_ackreq_count >= _cfg.num_ackreq && queued()) start();
+    if (bitsLeft()) return packetTiming();
+    else if (_ackreq_count < _cfg.num_ackreq) return ackreqTiming();
+    else return timings[std::to_underlying(_transfer_rate)].one;
+  }
+
+  /// Peek at next bit duration without advancing
+  ///
+  /// \return Bit duration in µs (0 if a queued packet starts next)
+  Timings::value_type peekTiming() const {
+    if (bitsLeft()) {
+      if constexpr (std::same_as<D, Packet>) return **_iter;
+      else return *_iter;
+    } else if (_ackreq_count < _cfg.num_ackreq)
+      return timings[std::to_underlying(_transfer_rate)].ackreq;
+    else if (queued()) return 0u;
+    else return timings[std::to_underlying(_transfer_rate)].one;
+  }
+
+  /// Check if packets are queued in a FIFO
+  ///
+  /// \retval true  Packets are queued
+  /// \retval false Single packet
+  static consteval bool fifo() { return N > 1uz; }
+
+  /// Number of queued packets (including the current)
+  ///
+  /// \return Number of queued packets
+  size_t queued() const {
+    if constexpr (fifo())
+      return _counts.tail.load(std::memory_order_acquire) -
+             _counts.head.load(std::memory_order_acquire);
+    else return bitsLeft() || _ackreq_count < _cfg.num_ackreq;
+  }
+
+  /// Start transmitting first queued packet
+  void start() {
+    size_t head{};
+    if constexpr (fifo()) head = _counts.head.load(std::memory_order_relaxed);
+    auto& packet{_packets[head % N]};
+    if constexpr (std::same_as<D, Packet>) _iter = &packet;
+    else {
+      _iter = std::cbegin(packet);
+      _last = std::cend(packet);
+    }
+    _ackreq_count = 0uz;
+  }
+
+  /// Release first queued packet once its ackreq phase is done
+  void stop() {
+    if constexpr (std::same_as<D, Packet>) _iter = nullptr;
+    else _iter = _last;
+    if constexpr (fifo()) {
+      auto const head{_counts.head.load(std::memory_order_relaxed)};
+      _counts.head.store(head + 1uz, std::memory_order_release);
+    }
+  }
+
+  /// Check if bits of current packet are left
+  ///
+  /// \retval true  Bits left
+  /// \retval false No bits left
+  bool bitsLeft() const {
+    if constexpr (std::same_as<D, Packet>)
+      return _iter && *_iter != std::cend(*_iter);
+    else return _iter != _last;
+  }
+
+  /// Check if next call of transmit calls back in ackreq phase
+  ///
+  /// \retval true  Next call calls back
+  /// \retval false Next call doesn't call back
+  bool callsBack() const {
+    if (bitsLeft() || _ackreq_count >= _cfg.num_ackreq) return false;
+    return !_ackreq_count || detail::is_channel1(_ackreq_count) ||
+           detail::is_channel2(_ackreq_count) ||
+           _ackreq_count + 1uz == _cfg.num_ackreq;
+  }
+
   /// Packet timing
   ///
   /// \return Next bit timing
   Timings::value_type packetTiming() {
-    auto const retval{*_iter};
-    ++_iter;
-    return retval;
+    if constexpr (std::same_as<D, Packet>) {
+      auto const retval{**_iter};
+      ++*_iter;
+      return retval;
+    } else {
+      auto const retval{*_iter};
+      ++_iter;
+      return retval;
+    }
   }
 
   /// ACKreq timing
@@ -163,16 +314,18 @@ private:
       impl().ackreqChannel2(_ackreq_count);
 
     // Check for ACKreq end
-    if (++_ackreq_count == _cfg.num_ackreq)
+    if (++_ackreq_count == _cfg.num_ackreq) {
       impl().ackreqEnd(); // Set initial state for ACKreq
+      stop();
+    }
 
     return timings[std::to_underlying(_transfer_rate)].ackreq;
   }
 
   /// Toggle track output
   void toggleTrackOutputs() {
-    if constexpr (requires(T t, bool N, bool P) {
-                    { t.trackOutputs(N, P) };
+    if constexpr (requires(T t, bool n, bool p) {
+                    { t.trackOutputs(n, p) };
                   }) {
       // By default the phase is "positive", so P > N for the first half bit.
       impl().trackOutputs(_polarity, !_polarity);
@@ -180,11 +333,16 @@ private:
     }
   }
 
-  value_type _packet{}; ///< Packet
+  std::array<value_type, N> _packets{}; ///< Queued packets
+  [[no_unique_address]] std::conditional_t<(N > 1uz), Counts, NoCounts>
+    _counts{}; ///< Counts of released and queued packets
 
-  /// Iterators
-  decltype(std::begin(_packet)) _iter{std::begin(_packet)};
-  decltype(std::cend(_packet)) _last{std::cend(_packet)};
+  /// Iterators of current packet (the adapter is its own iterator)
+  std::conditional_t<std::same_as<D, Packet>,
+                     TimingsAdapter*,
+                     Timings::const_iterator>
+    _iter{};
+  Timings::const_iterator _last{}; ///< Only used for timings
 
   size_t _ackreq_count{MDU_TX_MIN_ACKREQ_BITS};       ///< ACKReq counter
   TransferRate _transfer_rate{TransferRate::Default}; ///< Transfer rate
@@ -0,0 +1,25 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// Run of identical bit durations
+///
+/// \file   mdu/tx/run.hpp
+/// \author Vincent Hamp
+/// \date   18/10/2026
+
+#pragma once
+
+#include <cstdint>
+
+namespace mdu::tx {
+
+/// Run of identical bit durations (e.g. preamble, idle or ackreq phase)
+struct Run {
+  uint16_t duration{}; ///< Bit duration in µs
+  uint16_t count{};    ///< Number of consecutive bits
+
+  friend constexpr bool operator==(Run const&, Run const&) = default;
+};
+
+} // namespace mdu::tx
@@ -36,18 +36,38 @@ public:
                            TransferRate transfer_rate)
     : _packet{packet}, _cfg{cfg}, _transfer_rate{transfer_rate},
       _max_count{static_cast<size_type>(
-        _cfg.num_preamble + std::size(_packet) * (1uz + CHAR_BIT) + 1uz)} {}
+        _cfg.num_preamble + std::size(_packet) * (1uz + CHAR_BIT) + 1uz)},
+      _one{timings[std::to_underlying(_transfer_rate)].one},
+      _zero{timings[std::to_underlying(_transfer_rate)].zero},
+      _preamble{_cfg.num_preamble} {
+    _value = value();
+  }
   constexpr TimingsAdapter(std::span<uint8_t const> bytes,
                            Config cfg,
                            TransferRate transfer_rate)
     : _cfg{cfg}, _transfer_rate{transfer_rate},
       _max_count{static_cast<size_type>(
-        _cfg.num_preamble + std::size(bytes) * (1uz + CHAR_BIT) + 1uz)} {
+        _cfg.num_preamble + std::size(bytes) * (1uz + CHAR_BIT) + 1uz)},
+      _one{timings[std::to_underlying(_transfer_rate)].one},
+      _zero{timings[std::to_underlying(_transfer_rate)].zero},
+      _preamble{_cfg.num_preamble} {
     std::ranges::copy(bytes, std::back_inserter(_packet));
+    _value = value();
   }
 
+  /// Advance cursor by one bit
+  ///
+  /// Instead of deriving byte and bit from a counter (which takes a division
+  /// per bit), the cursor walks through preamble, bytes and bits. Each byte
+  /// starts with a mask of 0x100, which yields the zero start bit.
   constexpr TimingsAdapter& operator++() {
     ++_count;
+    if (_preamble) --_preamble;
+    else if (!(_mask >>= 1u)) {
+      _mask = 1u << CHAR_BIT;
+      ++_index;
+    }
+    _value = value();
     return *this;
   }
 
@@ -57,29 +77,7 @@ public:
     return retval;
   }
 
-  constexpr reference operator*() const {
-    // Preamble
-    auto const preamble_count{_cfg.num_preamble};
-    if (_count < preamble_count)
-      return timings[std::to_underlying(_transfer_rate)].one;
-
-    // Count without preamble
-    auto const i{static_cast<size_t>(_count - preamble_count)};
-
-    // Index of current byte
-    auto const byte_index{
-      static_cast<Packet::size_type>(i / ((1uz + CHAR_BIT)))};
-    if (byte_index >= std::size(_packet))
-      return timings[std::to_underlying(_transfer_rate)].one;
-
-    // Index of current bit
-    auto const bit_index{i % (1uz + CHAR_BIT)};
-    if (bit_index == 0uz)
-      return timings[std::to_underlying(_transfer_rate)].zero;
-    return _packet[byte_index] & 1u << (CHAR_BIT - 1uz - (bit_index - 1uz))
-             ? timings[std::to_underlying(_transfer_rate)].one
-             : timings[std::to_underlying(_transfer_rate)].zero;
-  }
+  constexpr reference operator*() const { return _value; }
 
   constexpr bool operator==(Sentinel) const { return _count >= _max_count; }
 
@@ -91,11 +89,26 @@ public:
   constexpr Sentinel cend() const { return {}; }
 
 private:
-  Packet _packet;                ///< MDU packet
-  Config _cfg{};                 ///< Config
-  TransferRate _transfer_rate{}; ///< Transfer rate
-  size_type _count{};            ///< Bit counter
-  size_type _max_count{};        ///< Max bit counter value
+  /// Timing of bit at cursor
+  ///
+  /// \return Timing
+  constexpr value_type value() const {
+    // Preamble and end
+    if (_preamble || _index >= std::size(_packet)) return _one;
+    return _packet[_index] & _mask ? _one : _zero;
+  }
+
+  Packet _packet;                 ///< MDU packet
+  Config _cfg{};                  ///< Config
+  TransferRate _transfer_rate{};  ///< Transfer rate
+  size_type _count{};             ///< Bit counter
+  size_type _max_count{};         ///< Max bit counter value
+  value_type _one{};              ///< Timing of one bit
+  value_type _zero{};             ///< Timing of zero bit
+  value_type _value{};            ///< Timing of bit at cursor
+  uint8_t _preamble{};            ///< Remaining preamble bits
+  Packet::size_type _index{};     ///< Index of current byte
+  uint16_t _mask{1u << CHAR_BIT}; ///< Mask of current bit (0x100 start)
 };
 
 constexpr auto begin(TimingsAdapter& c) -> decltype(c.begin()) {
@@ -0,0 +1,143 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// CRC32
+///
+/// \file   crc32.cpp
+/// \author Vincent Hamp
+/// \date   18/10/2026
+
+#include "crc32.hpp"
+#include <array>
+
+#if MDU_CRC32_CLMUL
+
+#  if defined(__x86_64__)
+#    include <immintrin.h>
+#  endif
+
+namespace mdu::detail {
+
+namespace {
+
+#  if defined(__x86_64__)
+/// Load 16 bytes with the first byte being the most significant one
+///
+/// \param  p Pointer to bytes
+/// \return 128 bit polynomial
+[[gnu::target("pclmul,ssse3")]] __m128i load(uint8_t const* p) {
+  auto const bswap{
+    _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0)};
+  return _mm_shuffle_epi8(
+    _mm_loadu_si128(reinterpret_cast<__m128i const*>(p)), bswap);
+}
+
+/// Store 16 bytes with the first byte being the most significant one
+///
+/// \param  x 128 bit polynomial
+/// \param  p Pointer to bytes
+[[gnu::target("pclmul,ssse3")]] void store(__m128i x, uint8_t* p) {
+  auto const bswap{
+    _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0)};
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(p), _mm_shuffle_epi8(x, bswap));
+}
+
+/// Fold 128 bit polynomial forward
+///
+/// Splits x into hi * x^64 + lo and multiplies both halves with precalculated
+/// remainders of x^(n+64) and x^n. The result is congruent to x * x^n and fits
+/// in 96 bits.
+///
+/// \param  x Polynomial
+/// \param  k Remainders x^(n+64) mod P (upper) and x^n mod P (lower)
+/// \return x * x^n (not fully reduced)
+[[gnu::target("pclmul,ssse3")]] __m128i fold(__m128i x, __m128i k) {
+  return _mm_xor_si128(_mm_clmulepi64_si128(x, k, 0x00),
+                       _mm_clmulepi64_si128(x, k, 0x11));
+}
+
+/// Make folding constants for a distance of N bytes
+///
+/// \tparam  N Distance in bytes
+/// \return  Remainders x^(8N+64) mod P (upper) and x^(8N) mod P (lower)
+template<size_t N>
+[[gnu::target("pclmul,ssse3")]] __m128i make_fold_constants() {
+  static constexpr auto hi{crc32_xpow8n(N + 8uz)};
+  static constexpr auto lo{crc32_xpow8n(N)};
+  return _mm_set_epi64x(hi, lo);
+}
+
+/// "CRC32" using PCLMULQDQ
+///
+/// The state of the "CRC32" after some bytes equals crc * x^(8n) + bytes mod P.
+/// The initial CRC gets folded by 16 bytes and XORed into the first 16 bytes, 4
+/// accumulators then fold 64 bytes per iteration. What remains gets reduced to
+/// 32 bits by shifting the 16 bytes of the final accumulator into an empty CRC.
+///
+/// \param  crc   Current CRC32
+/// \param  bytes Next bytes
+/// \return Next CRC32
+[[gnu::target("pclmul,ssse3")]] uint32_t
+crc32_pclmul(uint32_t crc, std::span<uint8_t const> bytes) {
+  auto const n{size(bytes) & ~63uz};
+  auto first{data(bytes)};
+  auto const last{first + n};
+  auto const k128{make_fold_constants<16uz>()};
+  auto x0{_mm_xor_si128(
+    load(first + 0), fold(_mm_cvtsi32_si128(static_cast<int>(crc)), k128))};
+  auto x1{load(first + 16)};
+  auto x2{load(first + 32)};
+  auto x3{load(first + 48)};
+
+  // Fold by 4
+  auto const k{make_fold_constants<64uz>()};
+  for (first += 64; first < last; first += 64) {
+    x0 = _mm_xor_si128(fold(x0, k), load(first + 0));
+    x1 = _mm_xor_si128(fold(x1, k), load(first + 16));
+    x2 = _mm_xor_si128(fold(x2, k), load(first + 32));
+    x3 = _mm_xor_si128(fold(x3, k), load(first + 48));
+  }
+
+  // Fold 4 into 1
+  x0 = fold(x0, make_fold_constants<48uz>());
+  x1 = fold(x1, make_fold_constants<32uz>());
+  x2 = fold(x2, k128);
+  x0 = _mm_xor_si128(_mm_xor_si128(x0, x1), _mm_xor_si128(x2, x3));
+
+  // Reduce
+  std::array<uint8_t, 16uz> tmp;
+  store(x0, data(tmp));
+  crc = crc32_next(0u, tmp);
+
+  return crc32_next(crc, bytes.subspan(n));
+}
+
+/// Check if CPU supports PCLMULQDQ
+///
+/// \retval true  PCLMULQDQ supported
+/// \retval false PCLMULQDQ not supported
+bool has_pclmul() {
+  static bool const retval{__builtin_cpu_supports("pclmul") &&
+                           __builtin_cpu_supports("ssse3")};
+  return retval;
+}
+#  endif
+
+} // namespace
+
+/// "CRC32" of bytes calculated by folding with carry-less multiplication
+///
+/// \param  crc   Current CRC32
+/// \param  bytes Next bytes
+/// \return Next CRC32
+uint32_t crc32_clmul(uint32_t crc, std::span<uint8_t const> bytes) {
+#  if defined(__x86_64__)
+  if (size(bytes) >= 64uz && has_pclmul()) return crc32_pclmul(crc, bytes);
+#  endif
+  return crc32_next(crc, bytes);
+}
+
+} // namespace mdu::detail
+
+#endif
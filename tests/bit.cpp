@@ -0,0 +1,14 @@
+#include <gtest/gtest.h>
+#include <mdu/mdu.hpp>
+
+TEST(Bit, time2bit_matches_windows) {
+  for (auto i{0uz}; i < size(mdu::timings); ++i)
+    for (auto time{0u}; time <= 2u * mdu::fallback_timing.ackreq_max; ++time)
+      EXPECT_EQ(mdu::time2bit(time, i), mdu::detail::time2bit_windows(time, i));
+}
+
+TEST(Bit, time2bit_of_large_times_is_invalid) {
+  for (auto i{0uz}; i < size(mdu::timings); ++i)
+    for (auto time : {UINT16_MAX - 1u, UINT16_MAX + 0u, UINT32_MAX})
+      EXPECT_EQ(mdu::time2bit(time, i), mdu::Invalid);
+}
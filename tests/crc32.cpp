@@ -2,6 +2,7 @@
 #include <gtest/gtest.h>
 #include <algorithm>
 #include <mdu/mdu.hpp>
+#include <numeric>
 #include <string_view>
 #include <vector>
 
@@ -62,4 +63,59 @@ TEST(Crc32, crc32) {
   EXPECT_EQ(mdu::crc32(str), 0x29EE'5C18u);
 }
 
+TEST(Crc32, span_matches_byte_by_byte_calculation) {
+  std::vector<uint8_t> v(1031uz);
+  std::iota(begin(v), end(v), 0u);
+  for (auto n{0uz}; n <= size(v); n += 13uz) {
+    std::span<uint8_t const> bytes{data(v), n};
+    auto const crc{mdu::crc32(bytes)};
+    uint32_t crc_old{slow_crc32(0xFFFF'FFFFu, data(bytes), n)};
+    crc_old = slow_crc32(crc_old, begin(zeros), 4u);
+    EXPECT_EQ(crc, crc_old);
+  }
+}
+
+TEST(Crc32, value_matches_shifting_zeros) {
+  for (auto state : {0u, 1u, 0x8000'0000u, 0xFFFF'FFFFu, 0x1234'5678u}) {
+    std::array<uint8_t, 4uz> bytes{};
+    mdu::uint32_2data(state, data(bytes));
+    mdu::Crc32 crc;
+    crc.next(bytes);
+    EXPECT_EQ(crc.value(), slow_crc32(crc.state(), begin(zeros), 4u));
+  }
+}
+
+TEST(Crc32, state_is_zero_after_appending_crc) {
+  std::array<uint8_t, 15uz> bytes{
+    'H', 'e', 'l', 'l', 'o', ' ', 'W', 'o', 'r', 'l', 'd'};
+  mdu::uint32_2data(mdu::crc32({cbegin(bytes), 11uz}), &bytes[11uz]);
+  mdu::Crc32 crc;
+  crc.next(bytes);
+  EXPECT_EQ(crc.state(), 0u);
+  EXPECT_EQ(crc.value(), 0u);
+}
+
+TEST(Crc32, large_spans_match_byte_by_byte_calculation) {
+  std::vector<uint8_t> v(4099uz);
+  std::ranges::generate(v, [i = 0u] mutable { return (i++ * 7u) ^ 0xA5u; });
+  for (auto offset : {0uz, 1uz, 3uz})
+    for (auto n : {64uz, 127uz, 128uz, 1000uz, 4096uz}) {
+      std::span<uint8_t const> bytes{data(v) + offset, n};
+      mdu::Crc32 crc;
+      std::ranges::for_each(bytes, [&crc](uint8_t byte) { crc.next(byte); });
+      EXPECT_EQ(mdu::crc32(bytes), crc.value());
+    }
+}
+
+TEST(Crc32, crc32_combine) {
+  std::vector<uint8_t> v(1000uz);
+  std::iota(begin(v), end(v), 42u);
+  auto const crc{mdu::crc32(v)};
+  for (auto n : {0uz, 1uz, 4uz, 64uz, 333uz, 999uz, 1000uz}) {
+    auto const crc_a{mdu::crc32({data(v), n})};
+    auto const crc_b{mdu::crc32({data(v) + n, size(v) - n})};
+    EXPECT_EQ(mdu::crc32_combine(crc_a, crc_b, size(v) - n), crc);
+  }
+}
+
 #pragma GCC diagnostic pop
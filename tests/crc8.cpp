@@ -17,3 +17,11 @@ TEST(Crc8, crc8) {
     'H', 'e', 'l', 'l', 'o', ' ', 'W', 'o', 'r', 'l', 'd'};
   EXPECT_EQ(mdu::crc8(str), 26u);
 }
+
+TEST(Crc8, lookup_table_matches_bitwise_calculation) {
+  for (auto i{0u}; i <= UINT8_MAX; ++i) {
+    mdu::Crc8 crc;
+    crc.next(static_cast<uint8_t>(i));
+    EXPECT_EQ(crc.value(), mdu::detail::crc8_bitwise(static_cast<uint8_t>(i)));
+  }
+}
@@ -139,6 +139,18 @@ PacketBuilder::makeZsuUpdatePacket(uint32_t addr,
   return packet;
 }
 
+PacketBuilder PacketBuilder::makeZsuCrc32StartPacket(uint32_t begin_addr,
+                                                     uint32_t end_addr,
+                                                     uint32_t crc) {
+  PacketBuilder packet;
+  packet.preamble()
+    .command(mdu::Command::ZsuCrc32Start)
+    .data(begin_addr, end_addr, crc)
+    .crc8()
+    .ackreq();
+  return packet;
+}
+
 PacketBuilder PacketBuilder::makeZppValidQueryPacket(std::string_view zpp_id,
                                                      size_t zpp_flash_size) {
   PacketBuilder packet;
@@ -63,6 +63,8 @@ public:
                                           uint32_t end_addr);
   static PacketBuilder
   makeZsuUpdatePacket(uint32_t addr, std::span<uint8_t const, 64uz> bytes);
+  static PacketBuilder
+  makeZsuCrc32StartPacket(uint32_t begin_addr, uint32_t end_addr, uint32_t crc);
   static PacketBuilder makeZppValidQueryPacket(std::string_view zpp_id,
                                                size_t zpp_flash_size);
   static PacketBuilder
@@ -53,11 +53,13 @@ TEST_F(ReceiveBaseTest, receive_packet_with_fallback_transfer_rate) {
   EXPECT_EQ(size(_mock->_deque), 1u);
 }
 
-TEST_F(ReceiveBaseTest, receive_packet_with_crc32) {
+TEST_F(ReceiveBaseTest, ignore_packet_exceeding_buffer) {
+  // Base without mixins doesn't buffer ZPP packets but still checks CRC32
+  Expectation ackbit_sent{EXPECT_CALL(*_mock, ackbit(_)).Times(Exactly(0))};
   std::array<uint8_t, 256uz> zpp_data;
   std::iota(begin(zpp_data), end(zpp_data), 0u);
   Receive(PacketBuilder::makeZppUpdatePacket(0u, zpp_data).timings());
-  EXPECT_EQ(size(_mock->_deque), 1u);
+  EXPECT_TRUE(empty(_mock->_deque));
 }
 
 TEST_F(ReceiveBaseTest, nack_packet_with_crc8_error) {
@@ -136,3 +138,44 @@ TEST_F(ReceiveBaseTest, active_after_receiving_one_preamble) {
   Receive(timings);
   EXPECT_TRUE(_mock->active());
 }
+
+TEST_F(ReceiveBaseTest, receive_buffer_of_times) {
+  auto const timings{PacketBuilder::makePingPacket(0u).timings()};
+  std::vector<uint32_t> const times(cbegin(timings), cend(timings));
+  _mock->receive(times);
+  EXPECT_EQ(size(_mock->_deque), 1u);
+}
+
+#if MDU_RX_CALIBRATE_PREAMBLE
+TEST_F(ReceiveBaseTest, receive_packet_with_timings_calibrated_to_preamble) {
+  // Command station clock runs ~9% slow, zero bits are out of tolerance
+  auto const& timing{
+    mdu::timings[std::to_underlying(mdu::TransferRate::Default)]};
+  auto timings{PacketBuilder::makePingPacket(0u).timingsWithoutAckreq()};
+  std::ranges::transform(timings, begin(timings), [&](uint16_t t) {
+    return static_cast<uint16_t>(t == timing.one    ? timing.one_max
+                                 : t == timing.zero ? timing.zero_max + 1u
+                                                    : t);
+  });
+  ASSERT_EQ(mdu::time2bit(timing.zero_max + 1u,
+                          std::to_underlying(mdu::TransferRate::Default)),
+            mdu::Invalid);
+  Receive(timings);
+  EXPECT_EQ(size(_mock->_deque), 1u);
+}
+
+TEST_F(ReceiveBaseTest, calibrate_to_preamble_after_minutes_of_idle) {
+  // Sum of all preamble times would have overflown after ~4.5min
+  auto const& timing{
+    mdu::timings[std::to_underlying(mdu::TransferRate::Default)]};
+  for (auto i{0uz}; i < 5'000'000uz; ++i) _mock->receive(timing.one_max);
+  auto timings{PacketBuilder::makePingPacket(0u).timingsWithoutAckreq()};
+  std::ranges::transform(timings, begin(timings), [&](uint16_t t) {
+    return static_cast<uint16_t>(t == timing.one    ? timing.one_max
+                                 : t == timing.zero ? timing.zero_max + 1u
+                                                    : t);
+  });
+  Receive(timings);
+  EXPECT_EQ(size(_mock->_deque), 1u);
+}
+#endif
@@ -13,7 +13,8 @@ TEST_F(ReceiveBaseTest, ack_busy_packet_when_busy) {
   auto config_packet{
     PacketBuilder::makeConfigTransferRatePacket(mdu::TransferRate::Default)};
   auto busy_packet{PacketBuilder::makeBusyPacket()};
-  Receive(config_packet.timings());
+  for (auto i{0uz}; i < _mock->_deque.max_size() - 1uz; ++i)
+    Receive(config_packet.timings());
   Receive(busy_packet.timingsWithoutAckreq());
   Execute();
   Receive(busy_packet.timingsAckreqOnly());
@@ -24,7 +25,8 @@ TEST_F(ReceiveBaseTest, do_not_nack_busy_packet_when_busy) {
   auto config_packet{
     PacketBuilder::makeConfigTransferRatePacket(mdu::TransferRate::Default)};
   auto busy_packet{PacketBuilder::makeBusyPacket()};
-  Receive(config_packet.timings());
+  for (auto i{0uz}; i < _mock->_deque.max_size() - 1uz; ++i)
+    Receive(config_packet.timings());
   Receive(busy_packet.timingsWithoutAckreq());
   Execute();
   Receive(busy_packet.timingsAckreqOnly(5u));
@@ -34,8 +36,36 @@ TEST_F(ReceiveBaseTest, nack_other_packets_when_busy) {
   Expectation nack_sent{EXPECT_CALL(*_mock, ackbit(100u)).Times(Exactly(3))};
   auto packet{
     PacketBuilder::makeConfigTransferRatePacket(mdu::TransferRate::Default)};
-  Receive(packet.timings());
+  for (auto i{0uz}; i < _mock->_deque.max_size() - 1uz; ++i)
+    Receive(packet.timings());
   Receive(packet.timingsWithoutAckreq());
   Execute();
   Receive(packet.timingsAckreqOnly(5u));
 }
+
+TEST_F(ReceiveBaseTest, nack_packets_only_when_deque_full) {
+  auto packet{
+    PacketBuilder::makeConfigTransferRatePacket(mdu::TransferRate::Default)};
+
+  // Fill all but the slot being received into
+  {
+    Expectation nack_sent{
+      EXPECT_CALL(*_mock, ackbit(100u)).Times(Exactly(0))};
+    for (auto i{0uz}; i < _mock->_deque.max_size() - 1uz; ++i)
+      Receive(packet.timings());
+    EXPECT_EQ(size(_mock->_deque), _mock->_deque.max_size() - 1uz);
+  }
+
+  // Next packet is busy
+  {
+    Expectation nack_sent{
+      EXPECT_CALL(*_mock, ackbit(100u)).Times(Exactly(3))};
+    Receive(packet.timings());
+    EXPECT_EQ(size(_mock->_deque), _mock->_deque.max_size() - 1uz);
+  }
+
+  // Executing a packet frees a slot
+  Execute();
+  Receive(packet.timings());
+  EXPECT_EQ(size(_mock->_deque), _mock->_deque.max_size() - 1uz);
+}
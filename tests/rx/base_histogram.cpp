@@ -0,0 +1,26 @@
+#include <algorithm>
+#include "../packet_builder.hpp"
+#include "base_test.hpp"
+
+#if MDU_RX_HISTOGRAM_BINS
+TEST_F(ReceiveBaseTest, histogram_of_received_times) {
+  auto timings{PacketBuilder::makePingPacket(0u).timings()};
+  timings.push_back(UINT16_MAX);
+  Receive(timings);
+
+  auto const& histogram{_mock->histogram()};
+  auto const count{[&](mdu::Bit bit, uint32_t time) {
+    return static_cast<std::ptrdiff_t>(
+      histogram.count(bit, histogram.bin(time)));
+  }};
+  auto const& timing{
+    mdu::timings[std::to_underlying(mdu::TransferRate::Default)]};
+  EXPECT_EQ(count(mdu::_1, timing.one),
+            std::ranges::count(timings, timing.one));
+  EXPECT_EQ(count(mdu::_0, timing.zero),
+            std::ranges::count(timings, timing.zero));
+  EXPECT_EQ(count(mdu::Ackreq, timing.ackreq),
+            std::ranges::count(timings, timing.ackreq));
+  EXPECT_EQ(count(mdu::Invalid, UINT16_MAX), 1);
+}
+#endif
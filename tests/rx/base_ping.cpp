@@ -100,3 +100,14 @@ TEST_F(ReceiveBaseTest,
   Receive(packet.timingsAckreqOnly());
   EXPECT_FALSE(_mock->selected());
 }
+
+TEST_F(ReceiveBaseTest, drop_packets_when_not_selected) {
+  Expectation ackbit_sent{EXPECT_CALL(*_mock, ackbit(_)).Times(Exactly(0))};
+  _mock->select(false);
+  Receive(
+    PacketBuilder::makeConfigTransferRatePacket(mdu::TransferRate::Default)
+      .timings());
+  EXPECT_TRUE(empty(_mock->_deque));
+  Receive(PacketBuilder::makePingPacket(0u).timings());
+  EXPECT_EQ(size(_mock->_deque), 1u);
+}
@@ -0,0 +1,66 @@
+#include <numeric>
+#include "../packet_builder.hpp"
+#include "base_test.hpp"
+
+using namespace testing;
+
+#if MDU_RX_STATISTICS
+TEST_F(ReceiveBaseTest, count_executed_packets) {
+  Receive(PacketBuilder::makePingPacket(0u).timings());
+  Execute();
+  Receive(
+    PacketBuilder::makeConfigTransferRatePacket(mdu::TransferRate::Default)
+      .timings());
+  Execute();
+  auto const& statistics{_mock->statistics()};
+  EXPECT_EQ(statistics.executedPackets(mdu::Command::Ping), 1u);
+  EXPECT_EQ(
+    statistics.executedPackets(mdu::Command::ConfigTransferRate), 1u);
+  EXPECT_EQ(statistics.executedPackets(mdu::Command::CvWrite), 0u);
+}
+
+TEST_F(ReceiveBaseTest, count_crc_errors_and_ackbits) {
+  EXPECT_CALL(*_mock, ackbit(100u)).Times(Exactly(9));
+  PacketBuilder crc8_packet;
+  crc8_packet.preamble()
+    .command(mdu::Command::Ping)
+    .data(static_cast<uint32_t>(0))
+    .crc8(42u) // Tinker with CRC8
+    .ackreq();
+  Receive(crc8_packet.timings());
+  std::array<uint8_t, 256uz> zpp_data;
+  std::iota(begin(zpp_data), end(zpp_data), 0u);
+  PacketBuilder crc32_packet;
+  crc32_packet.preamble()
+    .command(mdu::Command::ZppUpdate)
+    .data(static_cast<uint32_t>(0))
+    .data(zpp_data)
+    .crc32(42u) // Tinker with CRC32
+    .ackreq();
+  Receive(crc32_packet.timings());
+  auto const& statistics{_mock->statistics()};
+  EXPECT_EQ(statistics.crc8_errors, 1u);
+  EXPECT_EQ(statistics.crc32_errors, 1u);
+  EXPECT_EQ(statistics.channel1_ackbits, 6u);
+  EXPECT_EQ(statistics.channel2_ackbits, 3u);
+}
+
+TEST_F(ReceiveBaseTest, count_invalid_bits_and_resets) {
+  auto timings{PacketBuilder::makePingPacket(0u).timingsWithoutAckreq()};
+  timings[MDU_TX_MIN_PREAMBLE_BITS + 2uz] = 1000u; // Invalid time in data
+  Receive(timings);
+  auto const& statistics{_mock->statistics()};
+  EXPECT_EQ(statistics.invalid_bits, 1u);
+  EXPECT_EQ(statistics.data_resets, 1u);
+  EXPECT_EQ(statistics.endbit_resets, 0u);
+}
+
+TEST_F(ReceiveBaseTest, count_packets_exceeding_buffer) {
+  std::array<uint8_t, 256uz> zpp_data;
+  std::iota(begin(zpp_data), end(zpp_data), 0u);
+  Receive(PacketBuilder::makeZppUpdatePacket(0u, zpp_data).timings());
+  auto const& statistics{_mock->statistics()};
+  EXPECT_EQ(statistics.oversized, 1u);
+  EXPECT_EQ(statistics.crc32_errors, 0u);
+}
+#endif
@@ -0,0 +1,63 @@
+#include <numeric>
+#include <vector>
+#include "../packet_builder.hpp"
+#include "base_test.hpp"
+
+template<size_t Bits, uint32_t Frequency>
+using Adapter = mdu::rx::CaptureAdapter<BaseMock, Bits, Frequency>;
+
+TEST(CaptureAdapter, ticks2us) {
+  EXPECT_EQ((Adapter<16uz, 1'000'000u>::ticks2us(75u)), 75u);
+  EXPECT_EQ((Adapter<16uz, 16'000'000u>::ticks2us(75u * 16u)), 75u);
+  EXPECT_EQ((Adapter<16uz, 3'000'000u>::ticks2us(75u * 3u)), 75u);
+  EXPECT_EQ((Adapter<32uz, 84'000'000u>::ticks2us(1200u * 84u)), 1200u);
+  EXPECT_EQ((Adapter<32uz, 84'000'000u>::ticks2us(1200u * 84u - 1u)), 1199u);
+  EXPECT_EQ((Adapter<24uz, 500'000u>::ticks2us(10u)), 20u);
+}
+
+TEST_F(ReceiveBaseTest, receive_overflowing_16bit_captures) {
+  static constexpr auto frequency{3'000'000u};
+  Adapter<16uz, frequency> adapter{*_mock};
+  auto const timings{PacketBuilder::makePingPacket(0u).timings()};
+  std::vector<uint16_t> captures(size(timings));
+  std::transform_inclusive_scan(
+    cbegin(timings),
+    cend(timings),
+    begin(captures),
+    std::plus<uint16_t>{},
+    [](uint16_t t) {
+      return static_cast<uint16_t>(t * frequency / 1'000'000u);
+    },
+    static_cast<uint16_t>(UINT16_MAX - 1000u));
+  adapter.receive<uint16_t>(captures);
+  EXPECT_EQ(size(_mock->_deque), 1u);
+}
+
+TEST_F(ReceiveBaseTest, receive_buffers_of_overflowing_timestamps) {
+  Adapter<16uz, 1'000'000u> adapter{*_mock};
+  auto const timings{PacketBuilder::makePingPacket(0u).timings()};
+  std::vector<uint16_t> timestamps(size(timings));
+  std::inclusive_scan(cbegin(timings),
+                      cend(timings),
+                      begin(timestamps),
+                      std::plus<uint16_t>{},
+                      static_cast<uint16_t>(UINT16_MAX - 1000u));
+  auto const half{size(timestamps) / 2uz};
+  adapter.receive<uint16_t>(std::span{timestamps}.first(half));
+  adapter.receive<uint16_t>(std::span{timestamps}.subspan(half));
+  EXPECT_EQ(size(_mock->_deque), 1u);
+}
+
+#if MDU_RX_STATISTICS
+TEST_F(ReceiveBaseTest, first_capture_is_only_reference) {
+  Adapter<32uz, 1'000'000u> adapter{*_mock};
+  auto const timings{PacketBuilder::makePingPacket(0u).timings()};
+  std::vector<uint32_t> timestamps(size(timings) + 1uz);
+  timestamps.front() = 40000u;
+  std::inclusive_scan(
+    cbegin(timings), cend(timings), begin(timestamps) + 1, std::plus{}, 40000u);
+  adapter.receive<uint32_t>(timestamps);
+  EXPECT_EQ(_mock->statistics().invalid_bits, 0u);
+  EXPECT_EQ(size(_mock->_deque), 1u);
+}
+#endif
@@ -0,0 +1,41 @@
+#include <gtest/gtest.h>
+#include <mdu/mdu.hpp>
+#include <thread>
+
+TEST(SpscQueue, holds_one_element_less_than_slots) {
+  mdu::rx::SpscQueue<int, 3uz> q;
+  EXPECT_TRUE(empty(q));
+  *end(q) = 1;
+  q.push_back();
+  *end(q) = 2;
+  q.push_back();
+  EXPECT_EQ(size(q), q.max_size() - 1uz);
+  EXPECT_EQ(q.front(), 1);
+  q.pop_front();
+  EXPECT_EQ(q.front(), 2);
+  *end(q) = 3;
+  q.push_back();
+  q.pop_front();
+  EXPECT_EQ(q.front(), 3);
+  q.pop_front();
+  EXPECT_TRUE(empty(q));
+}
+
+TEST(SpscQueue, hand_over_elements_between_threads) {
+  static constexpr auto n{100'000};
+  mdu::rx::SpscQueue<int, 4uz> q;
+
+  std::jthread producer{[&q] {
+    for (auto i{0}; i < n; ++i) {
+      while (size(q) >= q.max_size() - 1uz) std::this_thread::yield();
+      *end(q) = i;
+      q.push_back();
+    }
+  }};
+
+  for (auto i{0}; i < n; ++i) {
+    while (empty(q)) std::this_thread::yield();
+    ASSERT_EQ(q.front(), i);
+    q.pop_front();
+  }
+}
@@ -0,0 +1,151 @@
+#include <numeric>
+#include "../packet_builder.hpp"
+#include "crtp_test_base.hpp"
+
+using namespace testing;
+
+struct StaticBaseMock : mdu::rx::StaticBase<StaticBaseMock> {
+  using mdu::rx::StaticBase<StaticBaseMock>::StaticBase;
+  using mdu::rx::StaticBase<StaticBaseMock>::select;
+  MOCK_METHOD(void, ackbit, (uint32_t), (const));
+  MOCK_METHOD(bool, readCv, (uint32_t, uint32_t), (const));
+  MOCK_METHOD(bool, writeCv, (uint32_t, uint8_t));
+};
+
+struct ReceiveStaticBaseTest : CrtpTestBase<ReceiveStaticBaseTest> {
+  ReceiveStaticBaseTest() { _mock = std::make_unique<StaticBaseMock>(_cfg); }
+  std::unique_ptr<StaticBaseMock> _mock;
+};
+
+static_assert(!std::is_polymorphic_v<StaticBaseMock::StaticBase>);
+
+TEST_F(ReceiveStaticBaseTest, ackbit) {
+  _mock->select(false);
+  EXPECT_CALL(*_mock, ackbit(100u)).Times(Exactly(3));
+  auto packet{PacketBuilder::makePingPacket(0u)};
+  Receive(packet.timingsWithoutAckreq());
+  Execute();
+  Receive(packet.timingsAckreqOnly());
+}
+
+TEST_F(ReceiveStaticBaseTest, read_cv) {
+  EXPECT_CALL(*_mock, readCv(7u, 3u)).WillOnce(Return(true));
+  EXPECT_CALL(*_mock, ackbit(100u)).Times(Exactly(3));
+  auto packet{PacketBuilder{}
+                .preamble()
+                .command(mdu::Command::CvRead)
+                .data(uint16_t{8u}, uint8_t{3u})
+                .crc8()
+                .ackreq()};
+  Receive(packet.timingsWithoutAckreq());
+  Execute();
+  Receive(packet.timingsAckreqOnly());
+}
+
+TEST_F(ReceiveStaticBaseTest, write_cv) {
+  EXPECT_CALL(*_mock, writeCv(7u, 42u)).WillOnce(Return(true));
+  EXPECT_CALL(*_mock, ackbit(_)).Times(0);
+  auto packet{PacketBuilder{}
+                .preamble()
+                .command(mdu::Command::CvWrite)
+                .data(uint16_t{8u}, uint8_t{42u})
+                .crc8()
+                .ackreq()};
+  Receive(packet.timingsWithoutAckreq());
+  Execute();
+  Receive(packet.timingsAckreqOnly());
+}
+
+struct StaticBaseZppMock
+  : mdu::rx::StaticBase<StaticBaseZppMock, mdu::rx::mixin::Zpp> {
+  using mdu::rx::StaticBase<StaticBaseZppMock, mdu::rx::mixin::Zpp>::StaticBase;
+  MOCK_METHOD(void, ackbit, (uint32_t), (const));
+  MOCK_METHOD(bool, readCv, (uint32_t, uint32_t), (const));
+  MOCK_METHOD(bool, writeCv, (uint32_t, uint8_t));
+  MOCK_METHOD(bool, zppValid, (std::string_view, size_t), (const));
+  MOCK_METHOD(bool, loadCodeValid, ((std::span<uint8_t const, 4uz>)), (const));
+  MOCK_METHOD(bool, eraseZpp, (uint32_t, uint32_t));
+  MOCK_METHOD(bool, writeZpp, (uint32_t, std::span<uint8_t const>));
+  MOCK_METHOD(bool, endZpp, ());
+  MOCK_METHOD(void, exitZpp, (bool));
+};
+
+struct ReceiveStaticBaseZppTest : CrtpTestBase<ReceiveStaticBaseZppTest> {
+  ReceiveStaticBaseZppTest() {
+    _mock = std::make_unique<StaticBaseZppMock>(_cfg);
+  }
+  std::unique_ptr<StaticBaseZppMock> _mock;
+};
+
+static_assert(!std::is_polymorphic_v<StaticBaseZppMock::StaticBase>);
+
+TEST_F(ReceiveStaticBaseZppTest, write_zpp_without_optional_callbacks) {
+  EXPECT_CALL(*_mock, zppValid(_, _)).WillOnce(Return(true));
+  EXPECT_CALL(*_mock, writeZpp(0x100u, _)).WillOnce(Return(true));
+  EXPECT_CALL(*_mock, ackbit(_)).Times(0);
+  std::array<uint8_t, 256uz> zpp_data;
+  std::iota(begin(zpp_data), end(zpp_data), 0u);
+  for (auto const& packet : {PacketBuilder::makeZppValidQueryPacket("SP", 0uz),
+                             PacketBuilder::makeZppUpdatePacket(0x100u,
+                                                                zpp_data)}) {
+    Receive(packet.timingsWithoutAckreq());
+    Execute();
+    Receive(packet.timingsAckreqOnly());
+  }
+}
+
+#if MDU_RX_ACK_QUEUE_SIZE
+struct StaticBaseQueueMock : mdu::rx::StaticBase<StaticBaseQueueMock> {
+  using mdu::rx::StaticBase<StaticBaseQueueMock>::StaticBase;
+  using mdu::rx::StaticBase<StaticBaseQueueMock>::select;
+  static constexpr bool queue_ack_pulses{true};
+  MOCK_METHOD(bool, readCv, (uint32_t, uint32_t), (const));
+  MOCK_METHOD(bool, writeCv, (uint32_t, uint8_t));
+};
+
+TEST(ReceiveStaticBaseQueueTest, queue_ack_pulses) {
+  StaticBaseQueueMock mock{{.ack_pwm_period = 10u, .ack_pwm_duty = 90u}};
+  mock.select(false);
+  auto packet{PacketBuilder::makePingPacket(0u)};
+  auto const timings{packet.timings()};
+  for (auto const t : timings) {
+    mock.receive(t);
+    mock.execute();
+  }
+
+  // Channel2 pulses start at the end of the 6th, 7th and 8th ackreq bit
+  auto& pulses{mock.ackPulses()};
+  ASSERT_EQ(size(pulses), 3uz);
+  auto const without_ackreq{packet.timingsWithoutAckreq()};
+  auto time{std::accumulate(cbegin(without_ackreq), cend(without_ackreq), 0u) +
+            5u * timings.back()};
+  for (auto i{0uz}; i < 3uz; ++i) {
+    time += timings.back();
+    auto const pulse{pulses.front()};
+    pulses.pop_front();
+    EXPECT_EQ(pulse.time, time);
+    EXPECT_EQ(pulse.us, 100u);
+    EXPECT_EQ(pulse.period, 10u);
+    EXPECT_EQ(pulse.duty, 90u);
+  }
+}
+
+#if MDU_RX_STATISTICS
+TEST(ReceiveStaticBaseQueueTest, count_lost_ack_pulses) {
+  StaticBaseQueueMock mock{{}};
+  mock.select(false);
+  auto const timings{PacketBuilder::makePingPacket(0u).timings()};
+  auto const packets{MDU_RX_ACK_QUEUE_SIZE / 3uz + 1uz};
+  for (auto i{0uz}; i < packets; ++i)
+    for (auto const t : timings) {
+      mock.receive(t);
+      mock.execute();
+    }
+
+  // Queue holds one pulse less than its size
+  EXPECT_EQ(size(mock.ackPulses()), MDU_RX_ACK_QUEUE_SIZE - 1uz);
+  EXPECT_EQ(mock.statistics().lost_ack_pulses,
+            packets * 3uz - (MDU_RX_ACK_QUEUE_SIZE - 1uz));
+}
+#endif
+#endif
@@ -0,0 +1,156 @@
+#include <numeric>
+#include <vector>
+#include "../packet_builder.hpp"
+#include "crtp_test_base.hpp"
+#include "zpp_mock.hpp"
+
+#if MDU_RX_ZPP_STREAMING
+
+using namespace testing;
+
+struct ZppStreamMock : ZppMock {
+  using ZppMock::ZppMock;
+  MOCK_METHOD(void,
+              streamZpp,
+              (uint32_t, std::span<uint8_t const>),
+              (override));
+  MOCK_METHOD(bool,
+              commitZpp,
+              (uint32_t, std::span<uint8_t const>),
+              (override));
+  MOCK_METHOD(void, abortZpp, (uint32_t), (override));
+};
+
+struct ReceiveZppStreamTest : CrtpTestBase<ReceiveZppStreamTest> {
+  ReceiveZppStreamTest() {
+    _mock = std::make_unique<ZppStreamMock>(_cfg);
+    std::iota(begin(_sound_data), end(_sound_data), 0u);
+    EXPECT_CALL(*_mock, zppValid(_, _)).WillOnce(Return(true));
+    auto packet{PacketBuilder::makeZppValidQueryPacket("SP", 0uz)};
+    Receive(packet.timingsWithoutAckreq());
+    Execute();
+    Receive(packet.timingsAckreqOnly());
+  }
+
+  std::array<uint8_t, 256uz> _sound_data;
+  std::unique_ptr<ZppStreamMock> _mock;
+};
+
+TEST_F(ReceiveZppStreamTest, stream_chunks_and_commit) {
+  std::vector<uint32_t> addrs;
+  std::vector<uint8_t> bytes;
+  EXPECT_CALL(*_mock, streamZpp(_, _))
+    .Times(Exactly(4))
+    .WillRepeatedly([&](uint32_t addr, std::span<uint8_t const> chunk) {
+      addrs.push_back(addr);
+      bytes.insert(cend(bytes), cbegin(chunk), cend(chunk));
+    });
+  EXPECT_CALL(*_mock, abortZpp(_)).Times(0);
+  EXPECT_CALL(*_mock, writeZpp(_, _)).Times(0);
+
+  auto packet{PacketBuilder::makeZppUpdatePacket(0x100u, _sound_data)};
+  Receive(packet.timingsWithoutAckreq());
+
+  // Whole payload streamed before execute
+  EXPECT_THAT(addrs, ElementsAre(0x100u, 0x140u, 0x180u, 0x1C0u));
+  EXPECT_TRUE(std::ranges::equal(bytes, _sound_data));
+
+  EXPECT_CALL(*_mock, commitZpp(0x100u, _)).WillOnce(Return(true));
+  Execute();
+  Receive(packet.timingsAckreqOnly());
+}
+
+TEST_F(ReceiveZppStreamTest, abort_repeated_packet) {
+  EXPECT_CALL(*_mock, streamZpp(_, _)).Times(Exactly(8));
+  EXPECT_CALL(*_mock, commitZpp(0x100u, _)).WillOnce(Return(true));
+  EXPECT_CALL(*_mock, abortZpp(0x100u)).Times(Exactly(1));
+
+  auto packet{PacketBuilder::makeZppUpdatePacket(0x100u, _sound_data)};
+  for (auto i{0uz}; i < 2uz; ++i) {
+    Receive(packet.timingsWithoutAckreq());
+    Execute();
+    Receive(packet.timingsAckreqOnly());
+  }
+}
+
+TEST_F(ReceiveZppStreamTest, abort_packet_after_lost_one) {
+  EXPECT_CALL(*_mock, streamZpp(_, _)).Times(Exactly(8));
+  EXPECT_CALL(*_mock, commitZpp(0x100u, _)).WillOnce(Return(true));
+  EXPECT_CALL(*_mock, abortZpp(0x300u)).Times(Exactly(1));
+
+  // Packet at 0x200 gets lost
+  for (auto const addr : {0x100u, 0x300u}) {
+    auto packet{PacketBuilder::makeZppUpdatePacket(addr, _sound_data)};
+    Receive(packet.timingsWithoutAckreq());
+    Execute();
+    Receive(packet.timingsAckreqOnly());
+  }
+}
+
+#if MDU_RX_DEQUE_SIZE >= 3u
+TEST_F(ReceiveZppStreamTest, abort_packet_after_deselecting_ping) {
+  EXPECT_CALL(*_mock, streamZpp(_, _)).Times(Exactly(4));
+  EXPECT_CALL(*_mock, abortZpp(0x100u)).Times(Exactly(1));
+  EXPECT_CALL(*_mock, commitZpp(_, _)).Times(0);
+
+  // Ping for another decoder is still pending while ZppUpdate gets streamed
+  Receive(PacketBuilder::makePingPacket(_serial_number + 1u, 0u).timings());
+  Receive(PacketBuilder::makeZppUpdatePacket(0x100u, _sound_data)
+            .timingsWithoutAckreq());
+  Execute();
+  Execute();
+}
+#endif
+
+TEST_F(ReceiveZppStreamTest, abort_on_crc32_error) {
+  EXPECT_CALL(*_mock, streamZpp(_, _)).Times(Exactly(4));
+  EXPECT_CALL(*_mock, abortZpp(0x100u)).Times(Exactly(1));
+  EXPECT_CALL(*_mock, commitZpp(_, _)).Times(0);
+
+  auto packet{PacketBuilder{}
+                .preamble()
+                .command(mdu::Command::ZppUpdate)
+                .data(0x100u)
+                .data(_sound_data)
+                .crc32(42u) // Tinker with CRC32
+                .ackreq()};
+  Receive(packet.timingsWithoutAckreq());
+  Execute();
+  Receive(packet.timingsAckreqOnly());
+}
+
+TEST_F(ReceiveZppStreamTest, abort_once_packet_exceeds_buffer) {
+  EXPECT_CALL(*_mock, streamZpp(_, _)).Times(Exactly(4));
+  EXPECT_CALL(*_mock, abortZpp(0x100u)).Times(Exactly(1));
+  EXPECT_CALL(*_mock, commitZpp(_, _)).Times(0);
+
+  // Replace end bit with 64 more zero bytes
+  auto packet{PacketBuilder::makeZppUpdatePacket(0x100u, _sound_data)};
+  auto const timings{packet.timingsWithoutAckreq()};
+  auto const& timing{
+    mdu::timings[std::to_underlying(mdu::TransferRate::Default)]};
+  std::for_each(cbegin(timings), cend(timings) - 1, [this](uint32_t t) {
+    _mock->receive(t);
+  });
+  for (auto i{0uz}; i < 64uz * 9uz; ++i) _mock->receive(timing.zero);
+  _mock->receive(timing.one);
+  Execute();
+}
+
+TEST_F(ReceiveZppStreamTest, abort_on_reset) {
+  EXPECT_CALL(*_mock, streamZpp(_, _)).Times(Exactly(1));
+  EXPECT_CALL(*_mock, abortZpp(0x100u)).Times(Exactly(1));
+  EXPECT_CALL(*_mock, commitZpp(_, _)).Times(0);
+
+  // Cut packet after first chunk and 4 more bytes
+  auto packet{PacketBuilder::makeZppUpdatePacket(0x100u, _sound_data)};
+  auto const timings{packet.timingsWithoutAckreq()};
+  auto const count{MDU_TX_MIN_PREAMBLE_BITS + (4uz + 4uz + 64uz + 4uz) * 9uz};
+  std::for_each_n(cbegin(timings), count, [this](uint32_t t) {
+    _mock->receive(t);
+  });
+  _mock->receive(0u); // Invalid bit
+  Execute();
+}
+
+#endif
@@ -0,0 +1,49 @@
+#include <numeric>
+#include "../packet_builder.hpp"
+#include "zsu_test.hpp"
+
+using namespace testing;
+
+struct ReceiveZsuCrc32StartTest : ReceiveZsuTest {
+  ReceiveZsuCrc32StartTest() {
+    std::iota(begin(_zsu_data), end(_zsu_data), 0u);
+    EXPECT_CALL(*_mock, writeZsu(_, _)).WillRepeatedly(Return(true));
+    for (auto i{0uz}; i < 3uz; ++i) {
+      std::ranges::transform(_zsu_data, begin(_zsu_data), [](uint8_t byte) {
+        return static_cast<uint8_t>(byte * 3u + 1u);
+      });
+      auto packet{PacketBuilder::makeZsuUpdatePacket(
+        static_cast<uint32_t>(i * size(_zsu_data)), _zsu_data)};
+      Receive(packet.timingsWithoutAckreq());
+      Execute();
+      Receive(packet.timingsAckreqOnly());
+      std::ranges::copy(_zsu_data, std::back_inserter(_image));
+    }
+  }
+
+  std::array<uint8_t, 64uz> _zsu_data;
+  std::vector<uint8_t> _image;
+};
+
+TEST_F(ReceiveZsuCrc32StartTest, crc32_of_update_packets_is_valid) {
+  Expectation ack_sent{EXPECT_CALL(*_mock, ackbit(100u)).Times(Exactly(0))};
+  auto packet{PacketBuilder::makeZsuCrc32StartPacket(
+    0u, static_cast<uint32_t>(size(_image) - 1uz), mdu::crc32(_image))};
+  Receive(packet.timingsWithoutAckreq());
+  Execute();
+  Receive(packet.timingsAckreqOnly());
+}
+
+TEST_F(ReceiveZsuCrc32StartTest, crc32_of_update_packets_is_invalid) {
+  Expectation ack_sent{EXPECT_CALL(*_mock, ackbit(100u)).Times(Exactly(3))};
+  auto packet{PacketBuilder::makeZsuCrc32StartPacket(
+    0u, static_cast<uint32_t>(size(_image) - 1uz), mdu::crc32(_image) ^ 1u)};
+  Receive(packet.timingsWithoutAckreq());
+  Execute();
+  Receive(packet.timingsAckreqOnly());
+  auto result{PacketBuilder{}};
+  result.preamble().command(mdu::Command::ZsuCrc32Result).crc8().ackreq();
+  Receive(result.timingsWithoutAckreq());
+  Execute();
+  Receive(result.timingsAckreqOnly());
+}
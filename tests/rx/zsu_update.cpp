@@ -82,3 +82,31 @@ TEST_F(ReceiveZsuTest, nack_update_addresses_greater_than_expected) {
     Receive(packet.timingsAckreqOnly());
   }
 }
+
+TEST_F(ReceiveZsuTest, ignore_too_large_packets) {
+  static_assert(ZsuMock::max_packet_size == 76uz);
+  Expectation ackbit_sent{EXPECT_CALL(*_mock, ackbit(_)).Times(Exactly(0))};
+  Expectation write_zsu{EXPECT_CALL(*_mock, writeZsu(_, _)).Times(Exactly(0))};
+  std::array<uint8_t, 256uz> zpp_data;
+  std::iota(begin(zpp_data), end(zpp_data), 0u);
+  auto packet{PacketBuilder::makeZppUpdatePacket(0u, zpp_data)};
+  Receive(packet.timingsWithoutAckreq());
+  Execute();
+  Receive(packet.timingsAckreqOnly());
+}
+
+TEST_F(ReceiveZsuTest, nack_too_large_packets_with_crc32_error) {
+  Expectation ackbit_sent{EXPECT_CALL(*_mock, ackbit(100u)).Times(Exactly(6))};
+  std::array<uint8_t, 256uz> zpp_data;
+  std::iota(begin(zpp_data), end(zpp_data), 0u);
+  PacketBuilder packet;
+  packet.preamble()
+    .command(mdu::Command::ZppUpdate)
+    .data(static_cast<uint32_t>(0))
+    .data(zpp_data)
+    .crc32(42u) // Tinker with CRC32
+    .ackreq();
+  Receive(packet.timingsWithoutAckreq());
+  Execute();
+  Receive(packet.timingsAckreqOnly());
+}
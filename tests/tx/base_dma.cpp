@@ -0,0 +1,50 @@
+#include "base_test.hpp"
+
+using ::testing::_;
+using ::testing::InSequence;
+
+TEST_F(TransmitBaseTest, fill_buffer_with_timings) {
+  auto builder{PacketBuilder::makeBusyPacket()};
+  auto const timings{builder.timings()};
+  ASSERT_TRUE(_mock.packet(builder.packet()));
+
+  // Preamble and data fit into one buffer, then fill stops before ackreqBegin
+  std::array<uint16_t, 512uz> buf;
+  auto const preamble_and_data{size(builder.timingsWithoutAckreq())};
+  ASSERT_EQ(_mock.transmit(buf), preamble_and_data);
+
+  // Callbacks happen at the beginning of each call
+  std::vector<size_t> lengths;
+  {
+    InSequence seq;
+    EXPECT_CALL(_mock, ackreqBegin());
+    for (auto i{2uz}; i <= 4uz; ++i) EXPECT_CALL(_mock, ackreqChannel1(i));
+    for (auto i{6uz}; i <= 8uz; ++i) EXPECT_CALL(_mock, ackreqChannel2(i));
+    EXPECT_CALL(_mock, ackreqEnd());
+  }
+  mdu::tx::Timings res;
+  std::copy_n(cbegin(buf), preamble_and_data, std::back_inserter(res));
+  while (size(res) < size(timings)) {
+    auto const left{std::min<size_t>(size(buf), size(timings) - size(res))};
+    auto const n{_mock.transmit(std::span{buf}.first(left))};
+    lengths.push_back(n);
+    std::copy_n(cbegin(buf), n, std::back_inserter(res));
+  }
+  ASSERT_EQ(res, timings);
+
+  // Begin, 2 reference bits, 3x channel1, 1 bit, 3x channel2 and the rest up
+  // to the last bit which calls ackreqEnd
+  auto const rest{_cfg.num_ackreq - 9uz - 1uz};
+  ASSERT_THAT(lengths,
+              ::testing::ElementsAre(2u, 1u, 1u, 2u, 1u, 1u, rest + 1u, 1u));
+
+  // Idle fills complete buffer
+  ASSERT_EQ(_mock.transmit(buf), size(buf));
+}
+
+TEST_F(TransmitBaseTest, fill_buffer_without_toggling_track_outputs) {
+  EXPECT_CALL(_mock, trackOutputs(_, _)).Times(0);
+  ASSERT_TRUE(_mock.packet(PacketBuilder::makeBusyPacket().packet()));
+  std::array<uint16_t, 512uz> buf;
+  _mock.transmit(buf);
+}
@@ -0,0 +1,71 @@
+#include "base_test.hpp"
+
+template<typename D, size_t N>
+struct FifoMock : mdu::tx::Base<FifoMock<D, N>, D, N> {
+  MOCK_METHOD(void, ackreqBegin, ());
+  MOCK_METHOD(void, ackreqChannel1, (size_t));
+  MOCK_METHOD(void, ackreqChannel2, (size_t));
+  MOCK_METHOD(void, ackreqEnd, ());
+};
+
+template<typename T>
+mdu::tx::Timings transmit(T& mock, size_t count) {
+  mdu::tx::Timings retval{};
+  for (auto i{0uz}; i < count; i++) retval.push_back(mock.transmit());
+  return retval;
+}
+
+template<typename T>
+void back_to_back() {
+  NiceMock<T> mock;
+  auto first{PacketBuilder::makeBusyPacket()};
+  auto second{PacketBuilder::makePingPacket(0u)};
+  auto third{PacketBuilder::makeZppExitPacket()};
+
+  // Queue all three at once, a fourth doesn't fit
+  ASSERT_TRUE(mock.packet(first.packet()));
+  ASSERT_TRUE(mock.packet(second.packet()));
+  ASSERT_TRUE(mock.packet(third.packet()));
+  ASSERT_FALSE(mock.packet(first.packet()));
+  ASSERT_FALSE(mock.isIdle());
+
+  // Packets follow each other without idle preamble
+  mdu::tx::Timings expected{};
+  for (auto const& builder : {first, second, third}) {
+    auto const timings{builder.timings()};
+    std::ranges::copy(timings, std::back_inserter(expected));
+  }
+  ASSERT_EQ(transmit(mock, size(expected)), expected);
+  ASSERT_TRUE(mock.isIdle());
+
+  // Followed by idle
+  ASSERT_EQ(
+    mock.transmit(),
+    mdu::timings[std::to_underlying(mdu::TransferRate::Default)].one);
+}
+
+TEST(TransmitBaseFifoTest, packets_back_to_back) {
+  back_to_back<FifoMock<mdu::Packet, 3uz>>();
+}
+
+TEST(TransmitBaseFifoTest, timings_back_to_back) {
+  back_to_back<FifoMock<mdu::tx::Timings, 3uz>>();
+}
+
+TEST(TransmitBaseFifoTest, queue_while_transmitting) {
+  NiceMock<FifoMock<mdu::Packet, 2uz>> mock;
+  auto builder{PacketBuilder::makeBusyPacket()};
+  auto const timings{builder.timings()};
+
+  // Queue next packet while the first one is being transmitted
+  ASSERT_TRUE(mock.packet(builder.packet()));
+  auto res{transmit(mock, 15uz)};
+  ASSERT_TRUE(mock.packet(builder.packet()));
+  ASSERT_FALSE(mock.packet(builder.packet()));
+
+  // First slot gets free after ackreq phase of first packet
+  auto tmp{transmit(mock, size(timings) - 15uz)};
+  std::ranges::copy(tmp, std::back_inserter(res));
+  ASSERT_EQ(res, timings);
+  ASSERT_TRUE(mock.packet(builder.packet()));
+}
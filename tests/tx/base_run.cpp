@@ -0,0 +1,53 @@
+#include "base_test.hpp"
+
+using ::testing::InSequence;
+
+TEST_F(TransmitBaseTest, runs) {
+  auto builder{PacketBuilder::makeBusyPacket()};
+  auto const timings{builder.timings()};
+  auto const& t{mdu::timings[std::to_underlying(mdu::TransferRate::Default)]};
+
+  {
+    InSequence seq;
+    EXPECT_CALL(_mock, ackreqBegin());
+    for (auto i{2uz}; i <= 4uz; ++i) EXPECT_CALL(_mock, ackreqChannel1(i));
+    for (auto i{6uz}; i <= 8uz; ++i) EXPECT_CALL(_mock, ackreqChannel2(i));
+    EXPECT_CALL(_mock, ackreqEnd());
+  }
+
+  ASSERT_TRUE(_mock.packet(builder.packet()));
+  std::vector<mdu::tx::Run> runs;
+  mdu::tx::Timings res;
+  while (size(res) < size(timings)) {
+    auto const run{_mock.transmitRun(UINT16_MAX)};
+    runs.push_back(run);
+    std::fill_n(std::back_inserter(res), run.count, run.duration);
+  }
+  ASSERT_EQ(res, timings);
+
+  // Preamble is a single run
+  ASSERT_EQ(runs.front(),
+            (mdu::tx::Run{t.one, static_cast<uint16_t>(_cfg.num_preamble)}));
+
+  // Ackreq phase split in front of callbacks
+  auto const rest{static_cast<uint16_t>(_cfg.num_ackreq - 9uz)};
+  ASSERT_THAT(std::span{runs}.last(8uz),
+              ::testing::ElementsAre(mdu::tx::Run{t.ackreq, 2u},
+                                     mdu::tx::Run{t.ackreq, 1u},
+                                     mdu::tx::Run{t.ackreq, 1u},
+                                     mdu::tx::Run{t.ackreq, 2u},
+                                     mdu::tx::Run{t.ackreq, 1u},
+                                     mdu::tx::Run{t.ackreq, 1u},
+                                     mdu::tx::Run{t.ackreq, rest},
+                                     mdu::tx::Run{t.ackreq, 1u}));
+}
+
+TEST_F(TransmitBaseTest, idle_run_ends_when_packet_queued) {
+  auto const& t{mdu::timings[std::to_underlying(mdu::TransferRate::Default)]};
+  ASSERT_EQ(_mock.transmitRun(100u), (mdu::tx::Run{t.one, 100u}));
+
+  auto builder{PacketBuilder::makeBusyPacket()};
+  ASSERT_TRUE(_mock.packet(builder.packet()));
+  ASSERT_EQ(_mock.transmitRun(100u),
+            (mdu::tx::Run{t.one, static_cast<uint16_t>(_cfg.num_preamble)}));
+}
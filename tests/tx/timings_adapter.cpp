@@ -1,6 +1,7 @@
 #include "base_test.hpp"
 
 #include <mdu/tx/timings_adapter.hpp>
+#include <numeric>
 
 TEST(TimingsAdapterTest, packet) {
   auto builder{PacketBuilder::makeBusyPacket()};
@@ -41,3 +42,18 @@ TEST(TimingsAdapterTest, transfer_rate) {
 
   ASSERT_EQ(result, timings);
 }
+
+TEST(TimingsAdapterTest, all_byte_values) {
+  std::array<uint8_t, 256uz> bytes;
+  std::iota(begin(bytes), end(bytes), 0u);
+  mdu::tx::Config const cfg{.num_preamble = 20u};
+  auto timings{mdu::tx::bytes2timings(bytes, cfg, mdu::TransferRate::Fast)};
+  timings.resize(size(timings) - cfg.num_ackreq); // Adapter has no ackreq
+
+  mdu::tx::TimingsAdapter a{bytes, cfg, mdu::TransferRate::Fast};
+
+  mdu::tx::Timings result;
+  std::ranges::copy(cbegin(a), cend(a), std::back_inserter(result));
+
+  ASSERT_EQ(result, timings);
+}